@@ -0,0 +1,225 @@
+"""In-process binding of det-k-decomp via ctypes over the C interface of the library
+(sources/DecomposerC.h, built by 'make lib' in the directory 'sources').
+
+The hypergraph is loaded (or given as edge lists) once and kept alive between the searches of a
+Decomposer. Each search returns a dict with the status, the width, the decomposition tree, the
+search counters, and the load and search times in nanoseconds.
+"""
+import ctypes
+import os
+
+DK_ERROR = -1
+DK_NOT_FOUND = 0
+DK_FOUND = 1
+DK_STOPPED = 2
+
+DK_API_VERSION = 2
+
+STATUS_NAMES = {DK_NOT_FOUND: 'not_found', DK_FOUND: 'found', DK_STOPPED: 'stopped'}
+
+_lib = None
+
+
+class DetKDecompError(Exception):
+    pass
+
+
+def library_path():
+    """Path of the shared library; can be overridden by the environment variable DETKDECOMP_LIB."""
+    return os.environ.get('DETKDECOMP_LIB',
+                          os.path.join(os.path.dirname(os.path.realpath(__file__)), 'sources', 'libdetkdecomp.so'))
+
+
+def load_library():
+    """Loads the shared library once; raises OSError if it is missing or has another API version."""
+    global _lib
+    if _lib is not None:
+        return _lib
+
+    lib = ctypes.CDLL(library_path())
+    # Check the version first since an older library lacks some of the functions below
+    lib.dk_api_version.restype = ctypes.c_int
+    lib.dk_api_version.argtypes = []
+    if lib.dk_api_version() != DK_API_VERSION:
+        raise OSError('%s has API version %s, expected %s' % (library_path(), lib.dk_api_version(), DK_API_VERSION))
+
+    c_int_p = ctypes.POINTER(ctypes.c_int)
+    handle = ctypes.c_void_p
+    signatures = {
+        'dk_create': (handle, []),
+        'dk_destroy': (None, [handle]),
+        'dk_api_version': (ctypes.c_int, []),
+        'dk_set_hypergraph': (ctypes.c_int, [handle, ctypes.c_int, ctypes.c_int, c_int_p, c_int_p]),
+        'dk_load_file': (ctypes.c_int, [handle, ctypes.c_char_p, ctypes.c_int]),
+        'dk_get_nbr_of_edges': (ctypes.c_int, [handle]),
+        'dk_get_nbr_of_nodes': (ctypes.c_int, [handle]),
+        'dk_get_edge_name': (ctypes.c_char_p, [handle, ctypes.c_int]),
+        'dk_get_node_name': (ctypes.c_char_p, [handle, ctypes.c_int]),
+        'dk_get_edge_nodes': (ctypes.c_int, [handle, ctypes.c_int, ctypes.POINTER(c_int_p)]),
+        'dk_set_threads': (None, [handle, ctypes.c_int]),
+        'dk_set_deadline': (None, [handle, ctypes.c_int]),
+        'dk_set_deadline_ms': (None, [handle, ctypes.c_longlong]),
+        'dk_set_cache': (None, [handle, ctypes.c_int]),
+        'dk_set_seed': (None, [handle, ctypes.c_uint]),
+        'dk_decompose': (ctypes.c_int, [handle, ctypes.c_int]),
+        'dk_optimize': (ctypes.c_int, [handle, ctypes.c_int]),
+        'dk_stop': (None, [handle]),
+        'dk_get_width': (ctypes.c_int, [handle]),
+        'dk_get_tree_size': (ctypes.c_int, [handle]),
+        'dk_get_parent': (ctypes.c_int, [handle, ctypes.c_int]),
+        'dk_get_chi': (ctypes.c_int, [handle, ctypes.c_int, ctypes.POINTER(c_int_p)]),
+        'dk_get_lambda': (ctypes.c_int, [handle, ctypes.c_int, ctypes.POINTER(c_int_p)]),
+        'dk_get_nbr_of_calls': (ctypes.c_longlong, [handle]),
+        'dk_get_nbr_of_seps': (ctypes.c_longlong, [handle]),
+        'dk_get_nbr_of_cut_parts': (ctypes.c_longlong, [handle]),
+        'dk_get_load_time': (ctypes.c_longlong, [handle]),
+        'dk_get_decomp_time': (ctypes.c_longlong, [handle]),
+        'dk_get_error': (ctypes.c_char_p, [handle]),
+    }
+    for name, (restype, argtypes) in signatures.items():
+        func = getattr(lib, name)
+        func.restype = restype
+        func.argtypes = argtypes
+    _lib = lib
+    return _lib
+
+
+def is_available():
+    try:
+        load_library()
+    except OSError:
+        return False
+    return True
+
+
+def _decode(value):
+    if isinstance(value, bytes):
+        return value.decode('utf-8', 'replace')
+    return value
+
+
+class Decomposer(object):
+    """Hypergraph together with the options and the result of the last search."""
+
+    def __init__(self, threads=1, deadline=0, cache=True):
+        self._lib = load_library()
+        self._handle = self._lib.dk_create()
+        if not self._handle:
+            raise MemoryError('dk_create failed')
+        self.set_threads(threads)
+        self.set_deadline(deadline)
+        self.set_cache(cache)
+
+    def __del__(self):
+        self.close()
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+    def close(self):
+        if getattr(self, '_handle', None):
+            self._lib.dk_destroy(self._handle)
+            self._handle = None
+
+    def _check(self, ret):
+        if ret == DK_ERROR:
+            raise DetKDecompError(_decode(self._lib.dk_get_error(self._handle)))
+        return ret
+
+    def load_file(self, filename, check_defs=False):
+        """Loads the hypergraph from a file in text, binary, or PACE format."""
+        if not isinstance(filename, bytes):
+            filename = filename.encode('utf-8')
+        self._check(self._lib.dk_load_file(self._handle, filename, int(check_defs)))
+
+    def set_hypergraph(self, edges, num_nodes=None):
+        """Sets the hypergraph given as a list of edges, each a list of node numbers starting with 0."""
+        start = [0]
+        nodes = []
+        for edge in edges:
+            nodes.extend(edge)
+            start.append(len(nodes))
+        if num_nodes is None:
+            num_nodes = max(nodes) + 1 if nodes else 0
+        start_arr = (ctypes.c_int * len(start))(*start)
+        nodes_arr = (ctypes.c_int * max(len(nodes), 1))(*nodes)
+        self._check(self._lib.dk_set_hypergraph(self._handle, len(edges), num_nodes, start_arr, nodes_arr))
+
+    def set_threads(self, threads):
+        self._lib.dk_set_threads(self._handle, threads)
+
+    def set_deadline(self, seconds):
+        """Sets the deadline of each search in seconds, which may have fractions (0 if unlimited)."""
+        ms = max(int(round(seconds * 1000)), 1) if seconds > 0 else 0
+        self._lib.dk_set_deadline_ms(self._handle, ms)
+
+    def set_cache(self, cache):
+        self._lib.dk_set_cache(self._handle, int(cache))
+
+    def set_seed(self, seed):
+        self._lib.dk_set_seed(self._handle, seed)
+
+    @property
+    def num_edges(self):
+        return self._lib.dk_get_nbr_of_edges(self._handle)
+
+    @property
+    def num_nodes(self):
+        return self._lib.dk_get_nbr_of_nodes(self._handle)
+
+    @property
+    def load_time_ns(self):
+        return self._lib.dk_get_load_time(self._handle)
+
+    def edge_name(self, edge):
+        return _decode(self._lib.dk_get_edge_name(self._handle, edge))
+
+    def node_name(self, node):
+        return _decode(self._lib.dk_get_node_name(self._handle, node))
+
+    def edge_nodes(self, edge):
+        """Returns the ascending list of node numbers of an edge."""
+        values = ctypes.POINTER(ctypes.c_int)()
+        n = self._check(self._lib.dk_get_edge_nodes(self._handle, edge, ctypes.byref(values)))
+        return values[:n]
+
+    def decompose(self, k):
+        """Searches for a decomposition of width at most k."""
+        return self._result(self._check(self._lib.dk_decompose(self._handle, k)))
+
+    def optimize(self, max_k=0):
+        """Searches for a decomposition of minimal width (at most max_k if max_k > 0)."""
+        return self._result(self._check(self._lib.dk_optimize(self._handle, max_k)))
+
+    def stop(self):
+        """Stops the search running in another thread, which then returns the status 'stopped'."""
+        self._lib.dk_stop(self._handle)
+
+    def tree(self):
+        """Returns the resulting decomposition as list of tree nodes in depth-first order (root first);
+        each tree node is a dict with the parent (-1 for the root), chi (node numbers), and lambda
+        (edge numbers)."""
+        nodes = []
+        values = ctypes.POINTER(ctypes.c_int)()
+        for t in range(self._lib.dk_get_tree_size(self._handle)):
+            n = self._lib.dk_get_chi(self._handle, t, ctypes.byref(values))
+            chi = values[:n]
+            n = self._lib.dk_get_lambda(self._handle, t, ctypes.byref(values))
+            nodes.append({'parent': self._lib.dk_get_parent(self._handle, t), 'chi': chi, 'lambda': values[:n]})
+        return nodes
+
+    def _result(self, status):
+        width = self._lib.dk_get_width(self._handle)
+        return {
+            'status': STATUS_NAMES[status],
+            'width': width if width > 0 else None,
+            'tree': self.tree(),
+            'decomp_calls': self._lib.dk_get_nbr_of_calls(self._handle),
+            'separators': self._lib.dk_get_nbr_of_seps(self._handle),
+            'pruned_components': self._lib.dk_get_nbr_of_cut_parts(self._handle),
+            'load_time_ns': self._lib.dk_get_load_time(self._handle),
+            'decomp_time_ns': self._lib.dk_get_decomp_time(self._handle),
+        }
@@ -1,5 +1,7 @@
+import bisect
 import re
 import sys
+import threading
 
 from subprocess import Popen, PIPE
 
@@ -127,3 +129,155 @@ def remove_tmp(instance):
     tmp = "%s.gml" % os.path.splitext(instance)[0]
     sys.stderr.write('TEMP INSTANCE was %s\n' % tmp)
     os.remove(tmp)
+
+
+# Decomposer of the running det_progression_lib and whether it was asked to stop
+_lib_run = {'decomposer': None, 'stopped': False}
+
+
+def stop_progression_lib():
+    """Stops det_progression_lib from a signal handler; it then returns the runs done so far."""
+    _lib_run['stopped'] = True
+    if _lib_run['decomposer'] is not None:
+        _lib_run['decomposer'].stop()
+
+
+def _decompose(decomposer, k):
+    """Runs decomposer.decompose(k) in a worker thread such that the main thread stays free for
+    signal handlers, which cannot run during a blocking ctypes call."""
+    result = {}
+
+    def run():
+        try:
+            result['ret'] = decomposer.decompose(k)
+        except Exception as e:
+            result['error'] = e
+
+    worker = threading.Thread(target=run)
+    worker.daemon = True
+    worker.start()
+    while worker.is_alive():
+        worker.join(0.1)
+        # A stop that arrives before the search has started is ignored by the library; repeat it
+        if _lib_run['stopped']:
+            decomposer.stop()
+    if 'error' in result:
+        raise result['error']
+    return result['ret']
+
+
+def _seconds(ns):
+    """Formats nanoseconds as detkdecomp prints seconds (and result_parser stores them)."""
+    return '%.6f' % (1e-9 * ns)
+
+
+def check_conditions(edges, tree):
+    """Checks the four hypertree conditions of a decomposition given by the tree nodes of
+    detkdecomp_lib (depth-first order, parents before children) over the node lists of the edges;
+    returns a list of four booleans."""
+    chis = [set(node['chi']) for node in tree]
+    # The subtree of tree node t consists of the tree nodes t, ..., ends[t]-1
+    ends = [t + 1 for t in range(len(tree))]
+    for t in range(len(tree) - 1, 0, -1):
+        parent = tree[t]['parent']
+        ends[parent] = max(ends[parent], ends[t])
+    occs = {}
+    for t, node in enumerate(tree):
+        for v in node['chi']:
+            occs.setdefault(v, []).append(t)
+
+    cond1 = all(any(set(edge) <= chis[t] for t in occs.get(edge[0], [])) for edge in edges)
+    # The occurrences of a node are connected iff exactly one of them has no parent containing it
+    cond2 = all(sum(1 for t in ts if tree[t]['parent'] < 0 or v not in chis[tree[t]['parent']]) == 1
+                for v, ts in occs.items())
+    lambda_vars = [set(v for e in node['lambda'] for v in edges[e]) for node in tree]
+    cond3 = all(chis[t] <= lambda_vars[t] for t in range(len(tree)))
+    cond4 = True
+    for t in range(len(tree)):
+        for v in lambda_vars[t] - chis[t]:
+            ts = occs.get(v, [])
+            k = bisect.bisect_right(ts, t)
+            if k < len(ts) and ts[k] < ends[t]:
+                cond4 = False
+    return [cond1, cond2, cond3, cond4]
+
+
+def det_progression_lib(instance, i):
+    """Same progression and output as det_progression, but in-process via detkdecomp_lib. Each run
+    has the keys that result_parser extracts from the output of detkdecomp; the hypertree
+    conditions are checked by check_conditions. Since the hypergraph is loaded only once, the load
+    time is reported as parse_wall of the first run, and the other parse and build times are 0."""
+    import detkdecomp_lib
+
+    ret = {
+        'solver': 'detkdecomp_progression',
+        'solved': 0,
+        'objective': 'nan',
+    }
+    wall_start = time.time()
+    inc = 1
+    previous = i
+    finished = False
+    sat = False
+    num_variables = num_hyperedges = None
+    with detkdecomp_lib.Decomposer() as decomposer:
+        _lib_run['decomposer'] = decomposer
+        try:
+            decomposer.load_file(instance)
+            load_time_ns = decomposer.load_time_ns
+            # result_parser keeps the counts as strings
+            num_variables = str(decomposer.num_nodes)
+            num_hyperedges = str(decomposer.num_edges)
+            edges = [decomposer.edge_nodes(e) for e in range(decomposer.num_edges)]
+            while not _lib_run['stopped']:
+                sys.stderr.write('DECOMPOSE k=%s %s\n' % (i, instance))
+                result = _decompose(decomposer, i)
+                run = {
+                    'parse_wall': _seconds(load_time_ns),
+                    'hgbuild_wall': _seconds(0),
+                    'num_variables': num_variables,
+                    'num_hyperedges': num_hyperedges,
+                }
+                load_time_ns = 0
+                if result['status'] == 'found':
+                    run['solve_wall'] = _seconds(result['decomp_time_ns'])
+                    run['objective'] = result['width']
+                elif result['status'] == 'not_found':
+                    run['unsat'] = True
+                if result['tree']:
+                    verify_start = time.time()
+                    conditions = check_conditions(edges, result['tree'])
+                    run['verify_wall'] = '%.6f' % (time.time() - verify_start)
+                    for c, satisfied in enumerate(conditions):
+                        if satisfied:
+                            run['cond%s' % (c + 1)] = 'satisfied'
+                run['solved'] = int(all('cond%s' % c in run for c in range(1, 5)) and 'objective' in run)
+                ret["run_%s" % inc] = run
+
+                if 'unsat' in run:
+                    finished = True
+                    break
+                if 'objective' not in run:
+                    break
+                sat = True
+
+                i = run['objective']
+
+                if i == 1:
+                    previous = i
+                    break
+                else:
+                    previous = i
+
+                inc += 1
+                i -= 1
+                sys.stderr.write('Continue with new objective %s\n' % i)
+        finally:
+            _lib_run['decomposer'] = None
+
+    ret['wall'] = time.time() - wall_start
+    ret['objective'] = previous
+    ret['num_variables'] = num_variables
+    ret['num_hyperedges'] = num_hyperedges
+    ret['solved'] = int(finished and sat)
+    return ret
@@ -23,7 +23,8 @@ from subprocess import Popen, PIPE
 
 import psutil
 
-from detkdecomp_prog import det_progression
+import detkdecomp_lib
+from detkdecomp_prog import det_progression, det_progression_lib, stop_progression_lib
 
 
 def handler(signum, frame):
@@ -34,6 +35,8 @@ def handler(signum, frame):
         sys.stderr.write('Child pid is %s\n' % (child.pid))
         sys.stderr.write('Killing child\n')
         os.kill(child.pid, 15)
+    # In library mode there are no children; stop the search such that the partial result is written
+    stop_progression_lib()
 
 
 signal.signal(signal.SIGTERM, handler)
@@ -81,7 +84,10 @@ def main(args):
     instance = args.instance
 
     i = args.k
-    ret = det_progression(instance, i, dir_path)
+    if detkdecomp_lib.is_available():
+        ret = det_progression_lib(instance, i)
+    else:
+        ret = det_progression(instance, i, dir_path)
     sys.stdout.write(json.dumps(ret, sort_keys=True))
     sys.stdout.write('\n')
     sys.stdout.flush()
@@ -0,0 +1,317 @@
+// Batch.cpp: implementation of the Batch class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <cstdio>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+
+using namespace std;
+
+#include "Batch.h"
+#include "Parser.h"
+#include "BinaryFormat.h"
+#include "PACEFormat.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "FlatHypertree.h"
+#include "DetKDecomp.h"
+#include "BucketElim.h"
+#include "Globals.h"
+#include "Verifier.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+Batch::Batch(int iK, bool bDef, bool bPACE, int iTimeLimit, unsigned int iSeed)
+{
+	iMyNextJob = 0;
+	iMyK = iK;
+	bMyDef = bDef;
+	bMyPACE = bPACE;
+	iMyTimeLimit = iTimeLimit;
+	iMySeed = iSeed;
+}
+
+
+Batch::~Batch()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+// Compares instances by the size of their input files
+static bool smallerJob(const BatchJob &Job1, const BatchJob &Job2)
+{
+	return Job1.lSize < Job2.lSize;
+}
+
+
+// Returns the seconds elapsed since a given point in time
+static double secondsSince(chrono::steady_clock::time_point Start)
+{
+	return chrono::duration<double>(chrono::steady_clock::now() - Start).count();
+}
+
+
+/*
+***Description***
+The method reads the list of instances. Each line contains the name of an input file optionally
+followed by the upper bound k of the hypertree-width for this instance; empty lines and lines
+starting with '#' are ignored. The instances are ordered by the sizes of their input files such
+that small instances are processed first.
+
+INPUT:	cNameOfFile: Name of the list file
+OUTPUT: -
+*/
+
+void Batch::readList(const char *cNameOfFile)
+{
+	ifstream List, Input;
+	string Line;
+	BatchJob Job;
+	size_t iEnd, iSep;
+
+	List.open(cNameOfFile, ios::in);
+	if(!List.is_open())
+		writeErrorMsg("Error opening file.", "Batch::readList");
+
+	while(getline(List, Line)) {
+		// Remove leading and trailing white space
+		iEnd = Line.find_last_not_of(" \t\r");
+		if(iEnd == string::npos)
+			continue;
+		Line.erase(iEnd+1);
+		Line.erase(0, Line.find_first_not_of(" \t"));
+		if(Line[0] == '#')
+			continue;
+
+		// Split off an optional upper bound of the hypertree-width
+		Job.iK = iMyK;
+		iSep = Line.find_last_of(" \t");
+		if((iSep != string::npos) && (Line.find_first_not_of("0123456789", iSep+1) == string::npos)) {
+			Job.iK = atoi(Line.c_str()+iSep+1);
+			Line.erase(Line.find_last_not_of(" \t", iSep)+1);
+		}
+		if(Job.iK < 1) {
+			cerr << "No upper bound k > 0 given for instance \"" << Line << "\"." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		Job.iIndex = (int)MyJobs.size();
+		Job.File = Line;
+		Input.open(Line.c_str(), ios::in | ios::binary | ios::ate);
+		Job.lSize = Input.is_open() ? (long long)Input.tellg() : -1;
+		Input.close();
+		Input.clear();
+		MyJobs.push_back(Job);
+	}
+
+	stable_sort(MyJobs.begin(), MyJobs.end(), smallerJob);
+}
+
+
+bool Batch::loadHypergraph(Hypergraph *HGraph, const char *cFile, int *iNbrOfAtoms, int *iNbrOfVars)
+{
+	bool bPACEInput = false;
+	BinaryFormat BF;
+	PACEFormat PF;
+	Parser *P;
+
+	if(BinaryFormat::isBinaryFile(cFile))
+		BF.readHypergraph(HGraph, cFile);
+	else if(PACEFormat::isPACEFile(cFile)) {
+		PF.readHypergraph(HGraph, cFile);
+		bPACEInput = true;
+	}
+	else {
+		P = new Parser(bMyDef);
+		try {
+			P->parseFile(cFile);
+			HGraph->buildHypergraph(P);
+		}
+		catch(...) {
+			delete P;
+			throw;
+		}
+		delete P;
+	}
+
+	*iNbrOfAtoms = HGraph->getNbrOfEdges();
+	*iNbrOfVars = HGraph->getNbrOfNodes();
+
+	return bPACEInput;
+}
+
+
+/*
+***Description***
+The method processes a single instance like a run of the program on this instance: it loads the
+hypergraph, searches for a hypertree decomposition of width at most k (falling back to bucket
+elimination if the search is stopped), checks the hypertree conditions, and writes the output
+files. Instead of progress messages, the result is returned as JSON object with the fields
+"index", "instance", "k", "status" ("found", "not_found", "stopped", or "error"), "width",
+"verified", "atoms", "variables", the search statistics, and the times in seconds. Errors in
+the instance are reported as status "error" with the error message.
+
+INPUT:	Job: Instance
+OUTPUT: return: JSON object describing the result
+*/
+
+string Batch::runJob(BatchJob *Job)
+{
+	int iNbrOfAtoms = -1, iNbrOfVars = -1, iWidth = -1;
+	bool bPACEInput = false, bVerified = false;
+	double rLoadTime = 0, rDecompTime = 0, rVerifyTime = 0;
+	string Status, Error, OutFile;
+	size_t iExt;
+	chrono::steady_clock::time_point Start, StartStep;
+	ostringstream Result;
+	Hypergraph HG;
+	Hypertree *HT = NULL;
+	FlatHypertree *FT = NULL;
+	DetKDecomp Decomp;
+	BucketElim BE;
+	Verifier V;
+
+	// Each instance uses the same random sequence regardless of the worker thread
+	random_init(iMySeed);
+	Start = chrono::steady_clock::now();
+
+	try {
+		StartStep = chrono::steady_clock::now();
+		bPACEInput = loadHypergraph(&HG, Job->File.c_str(), &iNbrOfAtoms, &iNbrOfVars);
+		rLoadTime = secondsSince(StartStep);
+
+		StartStep = chrono::steady_clock::now();
+		Decomp.setVerbose(false);
+		Decomp.setTimeLimit(iMyTimeLimit);
+		HT = Decomp.buildHypertree(&HG, Job->iK);
+		if(Decomp.isStopped()) {
+			Status = "stopped";
+			HT = BE.buildHypertree(&HG);
+		}
+		else if(HT == NULL)
+			Status = "not_found";
+		else
+			Status = "found";
+
+		// Flatten the hypertree and remove redundant nodes from decompositions found by the search
+		if(HT != NULL) {
+			if((FT = new FlatHypertree(&HG, HT)) == NULL)
+				writeErrorMsg("Error assigning memory.", "Batch::runJob");
+			delete HT;
+			HT = NULL;
+			if(Status == "found") {
+				FT->swapChiLambda();
+				FT->shrink(true);
+				FT->swapChiLambda();
+			}
+		}
+		rDecompTime = secondsSince(StartStep);
+
+		if(FT != NULL) {
+			iWidth = FT->getHTreeWidth();
+
+			// Check the hypertree conditions (condition 4 only for hypertree decompositions)
+			StartStep = chrono::steady_clock::now();
+			V.index(&HG, FT);
+			bVerified = (V.checkCond1() == NULL) && (V.checkCond2() == NULL) &&
+				(V.checkCond3() < 0) && ((Status != "found") || (V.checkCond4() < 0));
+			rVerifyTime = secondsSince(StartStep);
+
+			// Write the output files next to the input file
+			iExt = Job->File.find_last_of('.');
+			if((iExt == string::npos) || (iExt == 0) || (Job->File.find_first_of("/\\", iExt) != string::npos))
+				iExt = Job->File.size();
+			OutFile = Job->File.substr(0, iExt) + ".gml";
+			FT->outputToGML(&HG, (char *)OutFile.c_str());
+			if(bMyPACE || bPACEInput) {
+				OutFile = Job->File.substr(0, iExt) + ((Status == "found") ? ".htd" : ".ghd");
+				FT->outputToPACE(&HG, (char *)OutFile.c_str());
+			}
+		}
+	}
+	catch(exception &E) {
+		Status = "error";
+		Error = E.what();
+	}
+	delete HT;
+	delete FT;
+
+	Result << "{\"index\": " << Job->iIndex << ", \"instance\": " << toJSON(Job->File) << ", \"k\": " << Job->iK;
+	Result << ", \"status\": \"" << Status << "\"";
+	if(Status == "error")
+		Result << ", \"error\": " << toJSON(Error);
+	if(iWidth >= 0)
+		Result << ", \"width\": " << iWidth << ", \"verified\": " << (bVerified ? "true" : "false");
+	else
+		Result << ", \"width\": null";
+	Result << ", \"atoms\": " << iNbrOfAtoms << ", \"variables\": " << iNbrOfVars;
+	Result << ", \"decomp_calls\": " << Decomp.getNbrOfCalls() << ", \"separators\": " << Decomp.getNbrOfSeps();
+	Result << ", \"pruned_components\": " << Decomp.getNbrOfCutParts();
+	Result << ", \"load_time\": " << rLoadTime << ", \"decomp_time\": " << rDecompTime;
+	Result << ", \"verify_time\": " << rVerifyTime << ", \"total_time\": " << secondsSince(Start) << "}";
+
+	return Result.str();
+}
+
+
+void Batch::runWorker()
+{
+	BatchJob *Job;
+	string Line;
+
+	// Errors in an instance must not terminate the other instances
+	G_ThrowErrors = true;
+
+	while(true) {
+		MyMutex.lock();
+		Job = (iMyNextJob < (int)MyJobs.size()) ? &MyJobs[iMyNextJob++] : NULL;
+		MyMutex.unlock();
+		if(Job == NULL)
+			break;
+
+		// Skip the remaining instances if a stop was requested
+		if(G_StopSearch)
+			Line = "{\"index\": " + to_string(Job->iIndex) + ", \"instance\": " + toJSON(Job->File) + ", \"k\": " + to_string(Job->iK) + ", \"status\": \"skipped\"}";
+		else
+			Line = runJob(Job);
+
+		MyMutex.lock();
+		cout << Line << endl;
+		MyMutex.unlock();
+	}
+}
+
+
+void Batch::run(int iNbrOfThreads)
+{
+	int i;
+	vector<thread> Workers;
+
+	if(iNbrOfThreads < 1)
+		iNbrOfThreads = 1;
+	if(iNbrOfThreads > (int)MyJobs.size())
+		iNbrOfThreads = (MyJobs.size() > 0) ? (int)MyJobs.size() : 1;
+
+	for(i=0; i < iNbrOfThreads; i++)
+		Workers.push_back(thread(&Batch::runWorker, this));
+	for(i=0; i < iNbrOfThreads; i++)
+		Workers[i].join();
+}
@@ -0,0 +1,85 @@
+// Models the processing of many hypergraphs in one process by a pool of worker threads.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_BATCH)
+#define CLS_BATCH
+
+#include <string>
+#include <vector>
+#include <mutex>
+
+using namespace std;
+
+
+class Hypergraph;
+
+// Instance of a batch (one line of the list file)
+struct BatchJob
+{
+	// Position of the instance in the list file (starting with 0)
+	int iIndex;
+
+	// Name of the input file
+	string File;
+
+	// Upper bound of the hypertree-width
+	int iK;
+
+	// Size of the input file (used to process small instances first)
+	long long lSize;
+};
+
+class Batch
+{
+private:
+	// Instances in the order in which they are processed
+	vector<BatchJob> MyJobs;
+
+	// Position of the next instance to be processed
+	int iMyNextJob;
+
+	// Protects iMyNextJob and the standard output
+	mutex MyMutex;
+
+	// Default upper bound of the hypertree-width (0 if each instance specifies its own)
+	int iMyK;
+
+	// Indicates whether the definitions in the input files are checked
+	bool bMyDef;
+
+	// Indicates whether the decompositions are also written in PACE format
+	bool bMyPACE;
+
+	// Number of seconds after which the search for each instance is stopped (0 if unlimited)
+	int iMyTimeLimit;
+
+	// Seed of the random number generator for each instance
+	unsigned int iMySeed;
+
+	// Loads a hypergraph in any of the supported input formats
+	bool loadHypergraph(Hypergraph *HGraph, const char *cFile, int *iNbrOfAtoms, int *iNbrOfVars);
+
+	// Processes a single instance and returns the result as JSON object
+	string runJob(BatchJob *Job);
+
+	// Processes instances until no instance is left
+	void runWorker();
+
+public:
+	// Constructor
+	Batch(int iK, bool bDef, bool bPACE, int iTimeLimit, unsigned int iSeed);
+
+	// Destructor
+	virtual ~Batch();
+
+	// Reads the list of instances, i.e., lines of the form "<file> [<k>]"
+	void readList(const char *cNameOfFile);
+
+	// Processes all instances by iNbrOfThreads worker threads and writes one JSON line per instance
+	void run(int iNbrOfThreads);
+};
+
+
+#endif // !defined(CLS_BATCH)
@@ -0,0 +1,222 @@
+// BinaryFormat.cpp: implementation of the BinaryFormat class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <vector>
+#include <algorithm>
+
+using namespace std;
+
+#include "BinaryFormat.h"
+#include "Hypergraph.h"
+#include "Hyperedge.h"
+#include "Node.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+BinaryFormat::BinaryFormat()
+{
+}
+
+
+BinaryFormat::~BinaryFormat()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+bool BinaryFormat::isBinaryFile(const char *cNameOfFile)
+{
+	ifstream File;
+	int iMagic = 0;
+
+	File.open(cNameOfFile, ios::in | ios::binary);
+	if (!File.is_open())
+		return false;
+	File.read((char *)&iMagic, sizeof(int));
+
+	return File.good() && (iMagic == HGB_MAGIC);
+}
+
+
+/*
+***Description***
+The method constructs a hypergraph from a file in binary format. The node lists of the edges
+are used in place in the memory-mapped file; only the names are copied into a block owned by
+the hypergraph. All values are checked against the size of the file before they are used.
+
+INPUT:	HGraph: Empty hypergraph
+OUTPUT: HGraph: Hypergraph stored in MyFile
+*/
+
+void BinaryFormat::readContents(Hypergraph *HGraph)
+{
+	int i, iNbrOfEdges, iNbrOfNodes, iNbrOfIncs, iNameSize;
+	const int *Header, *EdgeNodeStart, *EdgeNodes, *NameOffsets;
+	char *cNames, **EdgeNames, **NodeNames;
+	size_t iSize;
+
+	// Check the header
+	Header = (const int *)MyFile.getData();
+	if ((MyFile.getSize() < HGB_HEADER_SIZE*sizeof(int)) || (Header[0] != HGB_MAGIC))
+		writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+	if (Header[1] != HGB_VERSION)
+		writeErrorMsg("Unsupported file version.", "BinaryFormat::readHypergraph");
+	iNbrOfEdges = Header[2];
+	iNbrOfNodes = Header[3];
+	iNbrOfIncs = Header[4];
+	iNameSize = Header[5];
+	if ((iNbrOfEdges < 0) || (iNbrOfNodes < 0) || (iNbrOfIncs < 0) || (iNameSize < 0))
+		writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+	iSize = (HGB_HEADER_SIZE + (size_t)iNbrOfEdges+1 + (size_t)iNbrOfIncs + (size_t)iNbrOfEdges + (size_t)iNbrOfNodes)*sizeof(int) + (size_t)iNameSize;
+	if (MyFile.getSize() != iSize)
+		writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+
+	EdgeNodeStart = Header + HGB_HEADER_SIZE;
+	EdgeNodes = EdgeNodeStart + iNbrOfEdges+1;
+	NameOffsets = EdgeNodes + iNbrOfIncs;
+
+	// Check the node lists of the edges
+	if ((EdgeNodeStart[0] != 0) || (EdgeNodeStart[iNbrOfEdges] != iNbrOfIncs))
+		writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+	for (i=0; i < iNbrOfEdges; i++)
+		if (EdgeNodeStart[i] > EdgeNodeStart[i+1])
+			writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+	for (i=0; i < iNbrOfIncs; i++)
+		if ((EdgeNodes[i] < 0) || (EdgeNodes[i] >= iNbrOfNodes))
+			writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+	for (i=0; i < iNbrOfEdges; i++)
+		if (adjacent_find(EdgeNodes+EdgeNodeStart[i], EdgeNodes+EdgeNodeStart[i+1], greater_equal<int>()) != EdgeNodes+EdgeNodeStart[i+1])
+			writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+
+	// Check that the name block is terminated and contains all names
+	if ((iNameSize > 0) && (((const char *)(NameOffsets + iNbrOfEdges + iNbrOfNodes))[iNameSize-1] != '\0'))
+		writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+	for (i=0; i < iNbrOfEdges + iNbrOfNodes; i++)
+		if ((NameOffsets[i] < 0) || (NameOffsets[i] >= iNameSize))
+			writeErrorMsg("Illegal file format.", "BinaryFormat::readHypergraph");
+
+	// Copy the name block
+	cNames = new char[iNameSize+1];
+	EdgeNames = new char*[iNbrOfEdges];
+	NodeNames = new char*[iNbrOfNodes];
+	if ((cNames == NULL) || (EdgeNames == NULL) || (NodeNames == NULL))
+		writeErrorMsg("Error assigning memory.", "BinaryFormat::readHypergraph");
+	memcpy(cNames, (const char *)(NameOffsets + iNbrOfEdges + iNbrOfNodes), iNameSize);
+	cNames[iNameSize] = '\0';
+
+	for (i=0; i < iNbrOfEdges; i++)
+		EdgeNames[i] = cNames + NameOffsets[i];
+	for (i=0; i < iNbrOfNodes; i++)
+		NodeNames[i] = cNames + NameOffsets[iNbrOfEdges+i];
+
+	HGraph->buildHypergraph(iNbrOfEdges, iNbrOfNodes, EdgeNodeStart, EdgeNodes, EdgeNames, NodeNames);
+	HGraph->setNameBlock(cNames);
+
+	delete [] EdgeNames;
+	delete [] NodeNames;
+	MyFile.close();
+}
+
+
+void BinaryFormat::readHypergraph(Hypergraph *HGraph, const char *cNameOfFile)
+{
+	if (!MyFile.open(cNameOfFile))
+		writeErrorMsg("Error opening file.", "BinaryFormat::readHypergraph");
+	readContents(HGraph);
+}
+
+
+void BinaryFormat::readHypergraph(Hypergraph *HGraph, const char *cData, size_t iSize)
+{
+	MyFile.assign(cData, iSize);
+	readContents(HGraph);
+}
+
+
+/*
+***Description***
+The method writes a hypergraph to a file in binary format. The nodes are numbered by their
+positions in the hypergraph; the node list of each edge is written in ascending order.
+
+INPUT:	HGraph: Hypergraph
+		cNameOfFile: Name of the file
+OUTPUT: -
+*/
+
+void BinaryFormat::writeHypergraph(Hypergraph *HGraph, const char *cNameOfFile)
+{
+	int i, j, iNbrOfEdges, iNbrOfNodes, iNameSize = 0;
+	vector<int> Data, EdgeNodes;
+	ofstream File;
+
+	iNbrOfEdges = HGraph->getNbrOfEdges();
+	iNbrOfNodes = HGraph->getNbrOfNodes();
+
+	// Number the nodes by their positions
+	for (i=0; i < iNbrOfNodes; i++)
+		HGraph->getNode(i)->setLabel(i);
+
+	Data.push_back(HGB_MAGIC);
+	Data.push_back(HGB_VERSION);
+	Data.push_back(iNbrOfEdges);
+	Data.push_back(iNbrOfNodes);
+	Data.push_back(0);
+	Data.push_back(0);
+
+	// Write the start positions of the node lists
+	Data.push_back(0);
+	for (i=0; i < iNbrOfEdges; i++)
+		Data.push_back(Data.back() + HGraph->getEdge(i)->getNbrOfNodes());
+	Data[4] = Data.back();
+
+	// Write the node lists
+	for (i=0; i < iNbrOfEdges; i++) {
+		EdgeNodes.clear();
+		for (j=0; j < HGraph->getEdge(i)->getNbrOfNodes(); j++)
+			EdgeNodes.push_back(HGraph->getEdge(i)->getNode(j)->getLabel());
+		sort(EdgeNodes.begin(), EdgeNodes.end());
+		Data.insert(Data.end(), EdgeNodes.begin(), EdgeNodes.end());
+	}
+
+	// Write the offsets of the names
+	for (i=0; i < iNbrOfEdges; i++) {
+		Data.push_back(iNameSize);
+		iNameSize += (int)strlen(HGraph->getEdge(i)->getName())+1;
+	}
+	for (i=0; i < iNbrOfNodes; i++) {
+		Data.push_back(iNameSize);
+		iNameSize += (int)strlen(HGraph->getNode(i)->getName())+1;
+	}
+	Data[5] = iNameSize;
+
+	HGraph->resetNodeLabels();
+
+	File.open(cNameOfFile, ios::out | ios::binary | ios::trunc);
+	if (!File.is_open())
+		writeErrorMsg("Error opening file.", "BinaryFormat::writeHypergraph");
+	File.write((const char *)Data.data(), Data.size()*sizeof(int));
+	for (i=0; i < iNbrOfEdges; i++)
+		File.write(HGraph->getEdge(i)->getName(), strlen(HGraph->getEdge(i)->getName())+1);
+	for (i=0; i < iNbrOfNodes; i++)
+		File.write(HGraph->getNode(i)->getName(), strlen(HGraph->getNode(i)->getName())+1);
+	File.close();
+	if (File.fail())
+		writeErrorMsg("Error writing file.", "BinaryFormat::writeHypergraph");
+}
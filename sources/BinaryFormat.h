@@ -0,0 +1,55 @@
+// Models a compact binary file format for hypergraphs that can be loaded without parsing.
+//
+// The file consists of 32-bit integers in native byte order followed by the names:
+// magic number, version, number of edges (E), number of nodes (N), number of incidences (I),
+// size of the name block (S), start positions of the node lists of the edges (E+1 values),
+// node lists of the edges (I values, ascending within each edge), offsets of the edge names
+// and node names in the name block (E+N values), and the name block ('\0'-terminated names).
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_BINARYFORMAT)
+#define CLS_BINARYFORMAT
+
+#include "MappedFile.h"
+
+
+#define HGB_MAGIC 0x42484B44  // "DKHB" in little-endian byte order
+#define HGB_VERSION 1
+#define HGB_HEADER_SIZE 6
+
+
+class Hypergraph;
+
+class BinaryFormat
+{
+private:
+	// Contents of the file
+	MappedFile MyFile;
+
+	// Constructs a hypergraph from the contents of MyFile
+	void readContents(Hypergraph *HGraph);
+
+public:
+	// Constructor
+	BinaryFormat();
+
+	// Destructor
+	virtual ~BinaryFormat();
+
+	// Checks whether a file starts with the magic number of the binary format
+	static bool isBinaryFile(const char *cNameOfFile);
+
+	// Constructs a hypergraph from a file in binary format
+	void readHypergraph(Hypergraph *HGraph, const char *cNameOfFile);
+
+	// Constructs a hypergraph from contents in binary format in memory (aligned for int arrays)
+	void readHypergraph(Hypergraph *HGraph, const char *cData, size_t iSize);
+
+	// Writes a hypergraph to a file in binary format
+	void writeHypergraph(Hypergraph *HGraph, const char *cNameOfFile);
+};
+
+
+#endif // !defined(CLS_BINARYFORMAT)
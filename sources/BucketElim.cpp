@@ -0,0 +1,142 @@
+// BucketElim.cpp: implementation of the BucketElim class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <fstream>
+#include <set>
+
+using namespace std;
+
+#include "BucketElim.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "Hyperedge.h"
+#include "Node.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+BucketElim::BucketElim()
+{
+}
+
+
+BucketElim::~BucketElim()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method constructs a tree decomposition of a hypergraph by bucket elimination. The nodes
+are eliminated in the reverse order of VarOrder, i.e., VarOrder[0] is eliminated last. Each 
+hyperedge is put into the bucket of its node that is eliminated first. When a node is 
+eliminated, the remaining nodes of its bucket are added to the bucket of the node among them
+that is eliminated next, which becomes the parent of the eliminated bucket.
+
+INPUT:	HGraph: Hypergraph
+		VarOrder: Order of the nodes in HGraph (terminated by NULL)
+OUTPUT: return: Tree decomposition of HGraph with empty lambda-sets
+*/
+
+Hypertree *BucketElim::buildTreeDecomp(Hypergraph *HGraph, Node **VarOrder)
+{
+	int iNbrOfNodes, iMaxPos, iPos, i, j;
+	Hyperedge *Edge;
+	Hypertree **Buckets, *HTree;
+	set<Node *>::iterator ChiIter;
+
+	iNbrOfNodes = HGraph->getNbrOfNodes();
+	if(iNbrOfNodes <= 0)
+		writeErrorMsg("Illegal number of nodes.", "BucketElim::buildTreeDecomp");
+
+	// Create a bucket for each node and label each node by its position in the order
+	Buckets = new Hypertree*[iNbrOfNodes];
+	if(Buckets == NULL)
+		writeErrorMsg("Error assigning memory.", "BucketElim::buildTreeDecomp");
+	for(i=0; i < iNbrOfNodes; i++) {
+		Buckets[i] = new Hypertree;
+		if(Buckets[i] == NULL)
+			writeErrorMsg("Error assigning memory.", "BucketElim::buildTreeDecomp");
+		Buckets[i]->insChi(VarOrder[i]);
+		VarOrder[i]->setLabel(i);
+	}
+
+	// Put each hyperedge into the bucket of its node eliminated first
+	for(i=0; i < HGraph->getNbrOfEdges(); i++) {
+		Edge = HGraph->getEdge(i);
+		for(iMaxPos=-1, j=0; j < Edge->getNbrOfNodes(); j++)
+			if(Edge->getNode(j)->getLabel() > iMaxPos)
+				iMaxPos = Edge->getNode(j)->getLabel();
+		if(iMaxPos >= 0)
+			for(j=0; j < Edge->getNbrOfNodes(); j++)
+				Buckets[iMaxPos]->insChi(Edge->getNode(j));
+	}
+
+	// Eliminate the nodes and connect the buckets
+	for(i=iNbrOfNodes-1; i > 0; i--) {
+		// Search for the node in the bucket eliminated next
+		iMaxPos = -1;
+		for(ChiIter=Buckets[i]->getChi()->begin(); ChiIter != Buckets[i]->getChi()->end(); ChiIter++) {
+			iPos = (*ChiIter)->getLabel();
+			if((iPos < i) && (iPos > iMaxPos))
+				iMaxPos = iPos;
+		}
+
+		if(iMaxPos >= 0) {
+			// Move the remaining nodes into the bucket of the node eliminated next
+			for(ChiIter=Buckets[i]->getChi()->begin(); ChiIter != Buckets[i]->getChi()->end(); ChiIter++)
+				if((*ChiIter)->getLabel() < i)
+					Buckets[iMaxPos]->insChi(*ChiIter);
+			Buckets[iMaxPos]->insChild(Buckets[i]);
+		}
+		else
+			// Connect the buckets of different connected components
+			Buckets[0]->insChild(Buckets[i]);
+	}
+
+	HTree = Buckets[0];
+	delete [] Buckets;
+
+	return HTree;
+}
+
+
+/*
+***Description***
+The method constructs a generalized hypertree decomposition of a hypergraph by bucket 
+elimination along the min-induced-width order and by covering the chi-set of each node 
+with hyperedges. The width of the decomposition is an upper bound on the generalized 
+hypertree-width (but not necessarily on the hypertree-width) of the hypergraph.
+
+INPUT:	HGraph: Hypergraph
+OUTPUT: return: Generalized hypertree decomposition of HGraph
+*/
+
+Hypertree *BucketElim::buildHypertree(Hypergraph *HGraph)
+{
+	Node **VarOrder;
+	Hypertree *HTree;
+
+	VarOrder = HGraph->getMIWOrder();
+	HTree = buildTreeDecomp(HGraph, VarOrder);
+	delete [] VarOrder;
+
+	// Remove redundant nodes and cover the chi-sets by hyperedges
+	HTree->shrink();
+	HTree->setLambda(HGraph);
+
+	return HTree;
+}
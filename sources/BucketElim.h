@@ -0,0 +1,31 @@
+// Models bucket elimination for computing heuristic decompositions.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_BUCKETELIM)
+#define CLS_BUCKETELIM
+
+
+class Hypergraph;
+class Hypertree;
+class Node;
+
+class BucketElim  
+{
+public:
+	// Constructor
+	BucketElim();
+
+	// Destructor
+	virtual ~BucketElim();
+
+	// Constructs a tree decomposition by eliminating the nodes in the reverse order of VarOrder
+	Hypertree *buildTreeDecomp(Hypergraph *HGraph, Node **VarOrder);
+
+	// Constructs a generalized hypertree decomposition according to the min-induced-width heuristic
+	Hypertree *buildHypertree(Hypergraph *HGraph);
+};
+
+
+#endif // !defined(CLS_BUCKETELIM)
@@ -0,0 +1,154 @@
+// Client.cpp: implementation of the Client class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+using namespace std;
+
+#include "Client.h"
+#include "Server.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+Client::Client()
+{
+	iMySocket = -1;
+}
+
+
+Client::~Client()
+{
+	close();
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(_WIN32)
+
+bool Client::connect(const char *cSocketFile)
+{
+	struct sockaddr_un Address;
+
+	close();
+
+	if(strlen(cSocketFile) >= sizeof(Address.sun_path))
+		return false;
+	memset(&Address, 0, sizeof(Address));
+	Address.sun_family = AF_UNIX;
+	strcpy(Address.sun_path, cSocketFile);
+
+	if((iMySocket = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		writeErrorMsg("Error creating socket.", "Client::connect");
+	if(::connect(iMySocket, (struct sockaddr *)&Address, sizeof(Address)) < 0) {
+		close();
+		return false;
+	}
+
+	return true;
+}
+
+
+/*
+***Description***
+The method sends a request consisting of the header line and the hypergraph to the server and
+reads the answer until the server closes the connection. The first line of the answer is the
+status line; the rest is the decomposition in the requested output format.
+
+INPUT:	cCommand: "decomp" or "optimize"
+		iK: Upper bound of the hypertree-width
+		iDeadline: Number of milliseconds after which the server stops the search (0 if unlimited)
+		cInFormat: Format of the hypergraph ("text", "text-def", "binary", or "pace")
+		cOutFormat: Format of the decomposition ("gml" or "htd")
+		cData: Hypergraph
+		iSize: Size of the hypergraph
+OUTPUT: Status: Status line without line break
+		Decomposition: Decomposition (empty if no decomposition was found)
+*/
+
+void Client::request(const char *cCommand, int iK, int iDeadline, const char *cInFormat, const char *cOutFormat,
+	const char *cData, size_t iSize, string *Status, string *Decomposition)
+{
+	char cHeader[SRV_MAX_HEADER+1], cBuffer[65536];
+	string Answer;
+	size_t iPos;
+	ssize_t iBytes;
+
+	sprintf(cHeader, "%.15s %d %d %.15s %.15s %llu\n", cCommand, iK, iDeadline, cInFormat, cOutFormat, (unsigned long long)iSize);
+
+	// Send the header and the hypergraph
+	if(send(iMySocket, cHeader, strlen(cHeader), 0) != (ssize_t)strlen(cHeader))
+		writeErrorMsg("Error sending request.", "Client::request");
+	for(iPos=0; iPos < iSize; iPos += (size_t)iBytes)
+		if((iBytes = send(iMySocket, cData+iPos, iSize-iPos, 0)) <= 0) {
+			// The server may have answered and closed the connection (e.g., if it is busy)
+			if(errno != EINTR)
+				break;
+			iBytes = 0;
+		}
+	shutdown(iMySocket, SHUT_WR);
+
+	// Receive the answer until the server closes the connection
+	while((iBytes = recv(iMySocket, cBuffer, sizeof(cBuffer), 0)) != 0)
+		if(iBytes > 0)
+			Answer.append(cBuffer, (size_t)iBytes);
+		else if(errno != EINTR)
+			writeErrorMsg("Error receiving answer.", "Client::request");
+
+	iPos = Answer.find('\n');
+	if(iPos == string::npos)
+		writeErrorMsg("Incomplete answer.", "Client::request");
+	Status->assign(Answer, 0, iPos);
+	Decomposition->assign(Answer, iPos+1, string::npos);
+}
+
+
+void Client::close()
+{
+	if(iMySocket >= 0)
+		::close(iMySocket);
+	iMySocket = -1;
+}
+
+#else
+
+bool Client::connect(const char *cSocketFile)
+{
+	writeErrorMsg("Unix domain sockets are not supported on this system.", "Client::connect");
+	return false;
+}
+
+
+void Client::request(const char *cCommand, int iK, int iDeadline, const char *cInFormat, const char *cOutFormat,
+	const char *cData, size_t iSize, string *Status, string *Decomposition)
+{
+}
+
+
+void Client::close()
+{
+}
+
+#endif
@@ -0,0 +1,40 @@
+// Models a client that sends a hypergraph to a decomposition server (see Server.h) and receives
+// the decomposition.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_CLIENT)
+#define CLS_CLIENT
+
+#include <string>
+
+using namespace std;
+
+
+class Client
+{
+private:
+	// Connection to the server
+	int iMySocket;
+
+public:
+	// Constructor
+	Client();
+
+	// Destructor
+	virtual ~Client();
+
+	// Connects to a server listening on a socket file; returns false if no server is listening
+	bool connect(const char *cSocketFile);
+
+	// Sends a request and receives the status line and the decomposition
+	void request(const char *cCommand, int iK, int iDeadline, const char *cInFormat, const char *cOutFormat,
+		const char *cData, size_t iSize, string *Status, string *Decomposition);
+
+	// Closes the connection
+	void close();
+};
+
+
+#endif // !defined(CLS_CLIENT)
@@ -6,6 +6,7 @@
 
 #include "Component.h"
 #include "Globals.h"
+#include "MemoryAccount.h"
 
 
 
@@ -37,6 +38,8 @@ Component::Component(int ID, char *cName, int iSize, int iNbrOfNeighbours, bool
 
 	iMyLabel = 0;
 	iMyWeight = 1;
+
+	MemoryAccount::add(MEM_HYPERGRAPH, sizeof(Component) + (long long)(iSize+iNbrOfNeighbours)*sizeof(Component *));
 }
 
 
@@ -44,6 +47,8 @@ Component::~Component()
 {
 	delete [] MyComponents;
 	delete [] MyNeighbours;
+
+	MemoryAccount::sub(MEM_HYPERGRAPH, sizeof(Component) + (long long)(iMyMaxSize+iMyMaxNbrOfNeighbours)*sizeof(Component *));
 }
 
 
@@ -92,6 +97,7 @@ void Component::updateNeighbourhood()
 	// Allocate memory for pointers to new neighbours
 	if(MyNeighbours != NULL)
 		delete [] MyNeighbours;
+	MemoryAccount::add(MEM_HYPERGRAPH, ((long long)Neighbours.size()-iMyMaxNbrOfNeighbours)*sizeof(Component *));
 	iMyMaxNbrOfNeighbours = (int)Neighbours.size();
 	MyNeighbours = new Component*[iMyMaxNbrOfNeighbours];
 	if(MyNeighbours == NULL)
@@ -108,6 +114,9 @@ void Component::updateSize()
 	int i;
 
 	for(i=0; (i < iMyMaxSize) && (MyComponents[i] != NULL); i++);
+
+	// The memory account follows the size such that the destructor releases what is left
+	MemoryAccount::sub(MEM_HYPERGRAPH, (long long)(iMyMaxSize-i)*sizeof(Component *));
 	iMyMaxSize = i;
 }
 
@@ -133,6 +142,7 @@ bool Component::rem(Component *Comp)
 		}
 
 	if(bFound) {
+		MemoryAccount::sub(MEM_HYPERGRAPH, sizeof(Component *));
 		--iMyMaxSize;
 		for(; i < iMyMaxSize; i++)
 			MyComponents[i] = MyComponents[i+1];
@@ -175,6 +185,7 @@ bool Component::remNeighbour(Component *Neighbour)
 		}
 
 	if(bFound) {
+		MemoryAccount::sub(MEM_HYPERGRAPH, sizeof(Component *));
 		--iMyMaxNbrOfNeighbours;
 		for(; i < iMyMaxNbrOfNeighbours; i++)
 			MyNeighbours[i] = MyNeighbours[i+1];
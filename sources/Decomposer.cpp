@@ -0,0 +1,726 @@
+// Decomposer.cpp: implementation of the Decomposer class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <climits>
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+#include <chrono>
+
+using namespace std;
+
+#include "Decomposer.h"
+#include "Parser.h"
+#include "BinaryFormat.h"
+#include "PACEFormat.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "FlatHypertree.h"
+#include "Hyperedge.h"
+#include "Node.h"
+#include "DetKDecomp.h"
+#include "BucketElim.h"
+#include "Globals.h"
+
+
+// Reports errors by exceptions instead of terminating the program while it exists
+class ThrowErrors
+{
+private:
+	bool bMyOldValue;
+
+public:
+	ThrowErrors() { bMyOldValue = G_ThrowErrors; G_ThrowErrors = true; }
+	~ThrowErrors() { G_ThrowErrors = bMyOldValue; }
+};
+
+
+// Returns the current time in nanoseconds
+static long long now()
+{
+	return (long long)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+// Stores a flat hypertree in depth-first order (parents before children) in a DecompTree
+static void extractTree(Hypergraph *HGraph, FlatHypertree *FTree, DecompTree *Tree)
+{
+	int t, i;
+
+	Tree->iWidth = FTree->getHTreeWidth();
+	Tree->Parents.clear();
+	Tree->ChiStart.clear();
+	Tree->Chi.clear();
+	Tree->LambdaStart.clear();
+	Tree->Lambda.clear();
+
+	for(t=0; t < FTree->getNbrOfNodes(); t++) {
+		Tree->ChiStart.push_back((int)Tree->Chi.size());
+		for(i=0; i < FTree->getChiSize(t); i++)
+			Tree->Chi.push_back(HGraph->getNode(FTree->getChi(t)[i])->getID());
+		sort(Tree->Chi.begin()+Tree->ChiStart.back(), Tree->Chi.end());
+
+		Tree->LambdaStart.push_back((int)Tree->Lambda.size());
+		for(i=0; i < FTree->getLambdaSize(t); i++)
+			Tree->Lambda.push_back(HGraph->getEdge(FTree->getLambda(t)[i])->getID());
+		sort(Tree->Lambda.begin()+Tree->LambdaStart.back(), Tree->Lambda.end());
+
+		Tree->Parents.push_back(FTree->getParent(t));
+	}
+
+	Tree->ChiStart.push_back((int)Tree->Chi.size());
+	Tree->LambdaStart.push_back((int)Tree->Lambda.size());
+}
+
+
+// Removes a decomposition from a DecompTree
+static void clearTree(DecompTree *Tree)
+{
+	Tree->iWidth = 0;
+	Tree->Parents.clear();
+	Tree->ChiStart.clear();
+	Tree->Chi.clear();
+	Tree->LambdaStart.clear();
+	Tree->Lambda.clear();
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+Decomposer::Decomposer()
+{
+	iMyNbrOfEdges = iMyNbrOfNodes = 0;
+	MyHGraph = NULL;
+	iMyNbrOfThreads = 1;
+	lMyDeadline = 0;
+	bMyCache = true;
+	iMySeed = 1;
+	iMyFailedK = 0;
+	clearTree(&MyBest);
+	iMyStatus = DK_NOT_FOUND;
+	clearTree(&MyResult);
+	lMyNbrOfCalls = lMyNbrOfSeps = lMyNbrOfCutParts = 0;
+	lMyLoadTime = lMyDecompTime = 0;
+	iMyNextK = iMyMaxK = iMyFoundK = iMyMaxFailedK = iMyMinStoppedK = 0;
+	bMyStop = false;
+}
+
+
+Decomposer::~Decomposer()
+{
+	delete MyHGraph;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method replaces the hypergraph. The edge lists are extracted from the hypergraph such that
+further copies of the hypergraph can be built for the threads of optimize. The results of
+previous searches are discarded.
+
+INPUT:	HGraph: Hypergraph (owned by the decomposer afterwards)
+OUTPUT: -
+*/
+
+void Decomposer::setHGraph(Hypergraph *HGraph)
+{
+	int i, j;
+	Hyperedge *Edge;
+
+	delete MyHGraph;
+	MyHGraph = HGraph;
+	iMyNbrOfEdges = HGraph->getNbrOfEdges();
+	iMyNbrOfNodes = HGraph->getNbrOfNodes();
+
+	MyEdgeNodeStart.assign(1, 0);
+	MyEdgeNodes.clear();
+	MyEdgeNames.resize(iMyNbrOfEdges);
+	MyNodeNames.resize(iMyNbrOfNodes);
+	for(i=0; i < iMyNbrOfEdges; i++) {
+		Edge = HGraph->getEdge(i);
+		for(j=0; j < Edge->getNbrOfNodes(); j++)
+			MyEdgeNodes.push_back(Edge->getNode(j)->getID());
+		sort(MyEdgeNodes.begin()+MyEdgeNodeStart.back(), MyEdgeNodes.end());
+		MyEdgeNodeStart.push_back((int)MyEdgeNodes.size());
+		MyEdgeNames[i] = Edge->getName();
+	}
+	for(i=0; i < iMyNbrOfNodes; i++)
+		MyNodeNames[i] = HGraph->getNode(i)->getName();
+
+	iMyFailedK = 0;
+	clearTree(&MyBest);
+	iMyStatus = DK_NOT_FOUND;
+	clearTree(&MyResult);
+}
+
+
+/*
+***Description***
+The method sets the hypergraph given by edge lists. The nodes of each edge may be given in any
+order; multiple occurrences are removed. The hypergraph must have an edge, each edge must contain
+a node, and each node must be contained in an edge. The names of the edges and nodes are their
+numbers.
+
+INPUT:	iNbrOfEdges: Number of edges
+		iNbrOfNodes: Number of nodes
+		EdgeNodeStart: Start positions of the node lists of the edges (iNbrOfEdges+1 values)
+		EdgeNodes: Node lists of the edges (nodes numbered from 0)
+OUTPUT: -
+*/
+
+void Decomposer::setHypergraph(int iNbrOfEdges, int iNbrOfNodes, const int *EdgeNodeStart, const int *EdgeNodes)
+{
+	int i, j;
+	long long lStart = now();
+	char *cNames, *cName;
+	vector<int> Start(1, 0), Nodes;
+	vector<char *> EdgeNames, NodeNames;
+	vector<bool> bUsed;
+	Hypergraph *HG;
+	ThrowErrors Errors;
+
+	// Check the edge lists and copy them with sorted node lists
+	if(iNbrOfEdges == 0)
+		writeErrorMsg("Hypergraph without edges.", "Decomposer::setHypergraph");
+	if((iNbrOfEdges < 0) || (iNbrOfNodes < 0) || (EdgeNodeStart == NULL) || (EdgeNodes == NULL) || (EdgeNodeStart[0] != 0))
+		writeErrorMsg("Illegal hypergraph.", "Decomposer::setHypergraph");
+	bUsed.assign(iNbrOfNodes, false);
+	for(i=0; i < iNbrOfEdges; i++) {
+		if(EdgeNodeStart[i+1] <= EdgeNodeStart[i])
+			writeErrorMsg("Edge without nodes.", "Decomposer::setHypergraph");
+		for(j=EdgeNodeStart[i]; j < EdgeNodeStart[i+1]; j++) {
+			if((EdgeNodes[j] < 0) || (EdgeNodes[j] >= iNbrOfNodes))
+				writeErrorMsg("Illegal node number.", "Decomposer::setHypergraph");
+			Nodes.push_back(EdgeNodes[j]);
+			bUsed[EdgeNodes[j]] = true;
+		}
+		sort(Nodes.begin()+Start.back(), Nodes.end());
+		Nodes.erase(unique(Nodes.begin()+Start.back(), Nodes.end()), Nodes.end());
+		Start.push_back((int)Nodes.size());
+	}
+	for(i=0; i < iNbrOfNodes; i++)
+		if(!bUsed[i])
+			writeErrorMsg("Node not contained in any edge.", "Decomposer::setHypergraph");
+
+	// Name the edges and nodes by their numbers
+	cNames = new char[((size_t)iNbrOfEdges + (size_t)iNbrOfNodes) * 11 + 1];
+	if(cNames == NULL)
+		writeErrorMsg("Error assigning memory.", "Decomposer::setHypergraph");
+	cName = cNames;
+	for(i=0; i < iNbrOfEdges; i++) {
+		EdgeNames.push_back(uitoa((unsigned int)i, cName));
+		cName += strlen(cName)+1;
+	}
+	for(i=0; i < iNbrOfNodes; i++) {
+		NodeNames.push_back(uitoa((unsigned int)i, cName));
+		cName += strlen(cName)+1;
+	}
+
+	HG = new Hypergraph();
+	if(HG == NULL)
+		writeErrorMsg("Error assigning memory.", "Decomposer::setHypergraph");
+	HG->buildHypergraph(iNbrOfEdges, iNbrOfNodes, Start.data(), Nodes.data(), EdgeNames.data(), NodeNames.data());
+	HG->setNameBlock(cNames);
+	setHGraph(HG);
+
+	lMyLoadTime = now() - lStart;
+}
+
+
+/*
+***Description***
+The method loads the hypergraph from a file in text, binary, or PACE format (see ReadMe.txt); the
+format is detected as in the command line mode. A file without hyperedges is rejected.
+
+INPUT:	cNameOfFile: Name of the file
+		bDef: true if the definitions in a file in text format are checked
+OUTPUT: -
+*/
+
+void Decomposer::loadFile(const char *cNameOfFile, bool bDef)
+{
+	long long lStart = now();
+	Hypergraph *HG;
+	Parser *P = NULL;
+	BinaryFormat BF;
+	PACEFormat PF;
+	ThrowErrors Errors;
+
+	HG = new Hypergraph();
+	if(HG == NULL)
+		writeErrorMsg("Error assigning memory.", "Decomposer::loadFile");
+	try {
+		if(BinaryFormat::isBinaryFile(cNameOfFile))
+			BF.readHypergraph(HG, cNameOfFile);
+		else if(PACEFormat::isPACEFile(cNameOfFile))
+			PF.readHypergraph(HG, cNameOfFile);
+		else {
+			P = new Parser(bDef);
+			P->parseFile(cNameOfFile);
+			HG->buildHypergraph(P);
+			delete P;
+			P = NULL;
+		}
+		if(HG->getNbrOfEdges() == 0)
+			writeErrorMsg("Hypergraph without edges.", "Decomposer::loadFile");
+	}
+	catch(...) {
+		delete P;
+		delete HG;
+		throw;
+	}
+	setHGraph(HG);
+
+	lMyLoadTime = now() - lStart;
+}
+
+
+int Decomposer::getNbrOfEdges()
+{
+	return iMyNbrOfEdges;
+}
+
+
+int Decomposer::getNbrOfNodes()
+{
+	return iMyNbrOfNodes;
+}
+
+
+const char *Decomposer::getEdgeName(int iEdge)
+{
+	return ((iEdge >= 0) && (iEdge < iMyNbrOfEdges)) ? MyEdgeNames[iEdge] : NULL;
+}
+
+
+int Decomposer::getEdgeNodes(int iEdge, const int **Nodes)
+{
+	if((iEdge < 0) || (iEdge >= iMyNbrOfEdges))
+		return -1;
+	*Nodes = MyEdgeNodes.data() + MyEdgeNodeStart[iEdge];
+
+	return MyEdgeNodeStart[iEdge+1] - MyEdgeNodeStart[iEdge];
+}
+
+
+const char *Decomposer::getNodeName(int iNode)
+{
+	return ((iNode >= 0) && (iNode < iMyNbrOfNodes)) ? MyNodeNames[iNode] : NULL;
+}
+
+
+void Decomposer::setThreads(int iNbrOfThreads)
+{
+	iMyNbrOfThreads = max(iNbrOfThreads, 1);
+}
+
+
+void Decomposer::setDeadline(int iSeconds)
+{
+	lMyDeadline = max(iSeconds, 0) * 1000LL;
+}
+
+
+void Decomposer::setDeadlineMs(long long lMilliseconds)
+{
+	lMyDeadline = max(lMilliseconds, 0LL);
+}
+
+
+void Decomposer::setSeed(unsigned int iSeed)
+{
+	iMySeed = iSeed;
+}
+
+
+void Decomposer::setCache(bool bCache)
+{
+	bMyCache = bCache;
+	if(!bCache) {
+		iMyFailedK = 0;
+		clearTree(&MyBest);
+	}
+}
+
+
+long long Decomposer::getTimeLeft(long long lStart)
+{
+	long long lLeft;
+
+	if(lMyDeadline == 0)
+		return 0;
+	lLeft = lMyDeadline - (now() - lStart) / 1000000LL;
+
+	return (lLeft > 0) ? lLeft : -1;
+}
+
+
+/*
+***Description***
+The method applies det-k-decomp to a hypergraph. The hypergraph must not be used by another
+thread at the same time since the search labels its edges and nodes.
+
+INPUT:	HGraph: Hypergraph
+		iK: Upper bound of the hypertree-width
+		lTimeLimit: Number of milliseconds after which the search is stopped (0 if unlimited)
+		StopFlag: Flag by which the search can be stopped by another thread (or NULL)
+OUTPUT: Tree: Decomposition if one was found
+		return: DK_FOUND, DK_NOT_FOUND, or DK_STOPPED
+*/
+
+int Decomposer::search(Hypergraph *HGraph, int iK, long long lTimeLimit, const atomic<bool> *StopFlag, DecompTree *Tree)
+{
+	int iStatus = DK_NOT_FOUND;
+	Hypertree *HT;
+	FlatHypertree *FT;
+	DetKDecomp Decomp;
+
+	// Each search uses the same random sequence
+	random_init(iMySeed);
+
+	Decomp.setVerbose(false);
+	Decomp.setTimeLimitMs(lTimeLimit);
+	Decomp.setStopFlag(StopFlag);
+	HT = Decomp.buildHypertree(HGraph, iK);
+
+	if(Decomp.isStopped())
+		iStatus = DK_STOPPED;
+	else if(HT != NULL) {
+		if((FT = new FlatHypertree(HGraph, HT)) == NULL)
+			writeErrorMsg("Error assigning memory.", "Decomposer::search");
+		delete HT;
+		HT = NULL;
+		FT->swapChiLambda();
+		FT->shrink(true);
+		FT->swapChiLambda();
+		extractTree(HGraph, FT, Tree);
+		delete FT;
+		iStatus = DK_FOUND;
+	}
+	delete HT;
+
+	MyMutex.lock();
+	lMyNbrOfCalls += Decomp.getNbrOfCalls();
+	lMyNbrOfSeps += Decomp.getNbrOfSeps();
+	lMyNbrOfCutParts += Decomp.getNbrOfCutParts();
+	MyMutex.unlock();
+
+	return iStatus;
+}
+
+
+void Decomposer::setHeuristicResult()
+{
+	Hypertree *HT;
+	FlatHypertree *FT;
+	BucketElim BE;
+
+	HT = BE.buildHypertree(MyHGraph);
+	if((FT = new FlatHypertree(MyHGraph, HT)) == NULL)
+		writeErrorMsg("Error assigning memory.", "Decomposer::setHeuristicResult");
+	delete HT;
+	extractTree(MyHGraph, FT, &MyResult);
+	delete FT;
+	iMyStatus = DK_STOPPED;
+}
+
+
+int Decomposer::setResult(int iStatus, int iK, DecompTree *Tree)
+{
+	iMyStatus = iStatus;
+	if(iStatus == DK_FOUND) {
+		MyResult = *Tree;
+		if(bMyCache && ((MyBest.iWidth == 0) || (Tree->iWidth < MyBest.iWidth)))
+			MyBest = *Tree;
+	}
+	else {
+		clearTree(&MyResult);
+		if(bMyCache && (iStatus == DK_NOT_FOUND))
+			iMyFailedK = max(iMyFailedK, iK);
+	}
+
+	return iStatus;
+}
+
+
+/*
+***Description***
+The method searches for a decomposition of width at most iK. If the cache is enabled, the search
+is skipped if a previous search already found a decomposition of width at most iK or showed that
+none exists. If the deadline is exceeded or the search is stopped by stop, the result is a
+heuristic decomposition obtained by bucket elimination (whose width may exceed iK).
+
+INPUT:	iK: Upper bound of the hypertree-width
+OUTPUT: return: DK_FOUND, DK_NOT_FOUND, or DK_STOPPED
+*/
+
+int Decomposer::decompose(int iK)
+{
+	int iStatus;
+	long long lStart = now();
+	DecompTree Tree;
+	ThrowErrors Errors;
+
+	if(MyHGraph == NULL)
+		writeErrorMsg("No hypergraph given.", "Decomposer::decompose");
+	if(iK <= 0)
+		writeErrorMsg("Illegal hypertree-width.", "Decomposer::decompose");
+	lMyNbrOfCalls = lMyNbrOfSeps = lMyNbrOfCutParts = 0;
+	bMyStop = false;
+
+	if(bMyCache && (iK <= iMyFailedK))
+		setResult(DK_NOT_FOUND, iK, &Tree);
+	else if(bMyCache && (MyBest.iWidth > 0) && (iK >= MyBest.iWidth))
+		setResult(DK_FOUND, iK, &MyBest);
+	else {
+		iStatus = search(MyHGraph, iK, getTimeLeft(lStart), &bMyStop, &Tree);
+		if(iStatus == DK_STOPPED)
+			setHeuristicResult();
+		else
+			setResult(iStatus, iK, &Tree);
+	}
+
+	lMyDecompTime = now() - lStart;
+
+	return iMyStatus;
+}
+
+
+/*
+***Description***
+The method tests the widths of optimize in increasing order until a decomposition is found. If
+several threads are used, each thread has its own copy of the hypergraph; when a decomposition
+is found, the tests of larger widths are stopped since they cannot improve the result. A test
+stopped by the deadline or by stop ends the thread.
+
+INPUT:	lStart: Start time of optimize
+		bOwnHGraph: true if the thread needs its own copy of the hypergraph
+OUTPUT: -
+*/
+
+void Decomposer::runOptimizeWorker(long long lStart, bool bOwnHGraph)
+{
+	int iK, iStatus;
+	long long lTimeLeft;
+	bool bStopped;
+	atomic<bool> bStop(false);
+	list<pair<int, atomic<bool> *> >::iterator TestIter;
+	DecompTree Tree;
+	Hypergraph *HG = MyHGraph;
+
+	// Errors in a worker thread are passed to the calling thread
+	G_ThrowErrors = true;
+
+	try {
+		if(bOwnHGraph) {
+			HG = new Hypergraph();
+			if(HG == NULL)
+				writeErrorMsg("Error assigning memory.", "Decomposer::runOptimizeWorker");
+			HG->buildHypergraph(iMyNbrOfEdges, iMyNbrOfNodes, MyEdgeNodeStart.data(), MyEdgeNodes.data(), MyEdgeNames.data(), MyNodeNames.data());
+		}
+
+		while(true) {
+			MyMutex.lock();
+			if((iMyNextK > iMyMaxK) || ((iMyFoundK > 0) && (iMyNextK > iMyFoundK)) || !MyWorkerError.empty() || bMyStop) {
+				MyMutex.unlock();
+				break;
+			}
+			iK = iMyNextK++;
+			bStop = false;
+			MyRunningTests.push_back(make_pair(iK, &bStop));
+			MyMutex.unlock();
+
+			lTimeLeft = getTimeLeft(lStart);
+			iStatus = (lTimeLeft < 0) ? DK_STOPPED : search(HG, iK, lTimeLeft, &bStop, &Tree);
+
+			MyMutex.lock();
+			MyRunningTests.remove(make_pair(iK, &bStop));
+			// Tests stopped only because a smaller width succeeded are not counted as stopped
+			bStopped = (iStatus == DK_STOPPED) && (!bStop || bMyStop);
+			if((iStatus == DK_FOUND) && ((iMyFoundK == 0) || (iK < iMyFoundK))) {
+				iMyFoundK = iK;
+				MyFound = Tree;
+				for(TestIter=MyRunningTests.begin(); TestIter != MyRunningTests.end(); TestIter++)
+					if(TestIter->first > iK)
+						*TestIter->second = true;
+			}
+			else if(iStatus == DK_NOT_FOUND)
+				iMyMaxFailedK = max(iMyMaxFailedK, iK);
+			else if(bStopped)
+				iMyMinStoppedK = min(iMyMinStoppedK, iK);
+			MyMutex.unlock();
+
+			if(bStopped)
+				break;
+		}
+	}
+	catch(exception &E) {
+		MyMutex.lock();
+		if(MyWorkerError.empty())
+			MyWorkerError = E.what();
+		for(TestIter=MyRunningTests.begin(); TestIter != MyRunningTests.end(); TestIter++)
+			*TestIter->second = true;
+		MyMutex.unlock();
+	}
+
+	if(bOwnHGraph)
+		delete HG;
+}
+
+
+/*
+***Description***
+The method searches for a decomposition of minimal width by testing the widths 1, 2, ... (starting
+above the largest width known to fail if the cache is enabled) with det-k-decomp. The tests are
+distributed over the given number of threads. If the deadline is exceeded or the search is
+stopped by stop before the optimal width is known, the status is DK_STOPPED and the result is the best decomposition found so far
+(or a heuristic decomposition if none was found).
+
+INPUT:	iMaxK: Upper bound of the hypertree-width (0 if unbounded)
+OUTPUT: return: DK_FOUND (the result has minimal width), DK_NOT_FOUND, or DK_STOPPED
+*/
+
+int Decomposer::optimize(int iMaxK)
+{
+	int i, iNbrOfThreads;
+	long long lStart = now();
+	vector<thread> Workers;
+	ThrowErrors Errors;
+
+	if(MyHGraph == NULL)
+		writeErrorMsg("No hypergraph given.", "Decomposer::optimize");
+	if(iMaxK < 0)
+		writeErrorMsg("Illegal hypertree-width.", "Decomposer::optimize");
+	lMyNbrOfCalls = lMyNbrOfSeps = lMyNbrOfCutParts = 0;
+
+	// Only widths below a cached decomposition have to be tested
+	iMyNextK = bMyCache ? iMyFailedK+1 : 1;
+	iMyMaxK = (iMaxK > 0) ? iMaxK : max(iMyNbrOfEdges, 1);
+	if(bMyCache && (MyBest.iWidth > 0))
+		iMyMaxK = min(iMyMaxK, MyBest.iWidth-1);
+	iMyFoundK = iMyMaxFailedK = 0;
+	iMyMinStoppedK = INT_MAX;
+	MyWorkerError.clear();
+	MyMutex.lock();
+	bMyStop = false;
+	MyRunningTests.clear();
+	MyMutex.unlock();
+
+	iNbrOfThreads = min(iMyNbrOfThreads, max(iMyMaxK-iMyNextK+1, 1));
+	if(iNbrOfThreads == 1)
+		runOptimizeWorker(lStart, false);
+	else {
+		for(i=0; i < iNbrOfThreads; i++)
+			Workers.push_back(thread(&Decomposer::runOptimizeWorker, this, lStart, true));
+		for(i=0; i < iNbrOfThreads; i++)
+			Workers[i].join();
+	}
+	if(!MyWorkerError.empty())
+		throw runtime_error(MyWorkerError);
+
+	if(bMyCache)
+		iMyFailedK = max(iMyFailedK, iMyMaxFailedK);
+	if(iMyFoundK > 0) {
+		setResult(DK_FOUND, iMyFoundK, &MyFound);
+		if(iMyMinStoppedK < iMyFoundK)
+			iMyStatus = DK_STOPPED;
+	}
+	else if(iMyMinStoppedK == INT_MAX) {
+		// All tested widths failed; a cached decomposition has minimal width
+		if(bMyCache && (MyBest.iWidth > 0) && ((iMaxK == 0) || (MyBest.iWidth <= iMaxK)))
+			setResult(DK_FOUND, MyBest.iWidth, &MyBest);
+		else
+			setResult(DK_NOT_FOUND, iMyMaxK, &MyFound);
+	}
+	else if(bMyCache && (MyBest.iWidth > 0) && ((iMaxK == 0) || (MyBest.iWidth <= iMaxK))) {
+		setResult(DK_FOUND, MyBest.iWidth, &MyBest);
+		iMyStatus = DK_STOPPED;
+	}
+	else
+		setHeuristicResult();
+
+	lMyDecompTime = now() - lStart;
+
+	return iMyStatus;
+}
+
+
+/*
+***Description***
+The method stops the running decompose or optimize from another thread: the stop flags of all
+running tests are set and optimize starts no further tests. The search returns DK_STOPPED with the
+best decomposition found so far (or a heuristic decomposition). A call while no search is running
+has no effect since each search clears the flag when it starts.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void Decomposer::stop()
+{
+	list<pair<int, atomic<bool> *> >::iterator TestIter;
+
+	MyMutex.lock();
+	bMyStop = true;
+	for(TestIter=MyRunningTests.begin(); TestIter != MyRunningTests.end(); TestIter++)
+		*TestIter->second = true;
+	MyMutex.unlock();
+}
+
+
+int Decomposer::getStatus()
+{
+	return iMyStatus;
+}
+
+
+const DecompTree *Decomposer::getResult()
+{
+	return &MyResult;
+}
+
+
+long long Decomposer::getNbrOfCalls()
+{
+	return lMyNbrOfCalls;
+}
+
+
+long long Decomposer::getNbrOfSeps()
+{
+	return lMyNbrOfSeps;
+}
+
+
+long long Decomposer::getNbrOfCutParts()
+{
+	return lMyNbrOfCutParts;
+}
+
+
+long long Decomposer::getLoadTime()
+{
+	return lMyLoadTime;
+}
+
+
+long long Decomposer::getDecompTime()
+{
+	return lMyDecompTime;
+}
@@ -0,0 +1,173 @@
+// Models the embeddable interface of det-k-decomp: hypergraphs are given as edge lists in memory
+// (or loaded from a file once), and the decompositions are returned as arrays that can be walked
+// without writing any files. Errors are reported by exceptions of type runtime_error.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_DECOMPOSER)
+#define CLS_DECOMPOSER
+
+#include <vector>
+#include <list>
+#include <mutex>
+#include <atomic>
+#include <string>
+
+#include "DecomposerC.h"
+
+using namespace std;
+
+
+class Hypergraph;
+class Hypertree;
+
+// Decomposition as arrays; the tree nodes are numbered in depth-first order starting with the root
+struct DecompTree
+{
+	// Width of the decomposition (0 if there is none)
+	int iWidth;
+
+	// Parent of each tree node (-1 for the root)
+	vector<int> Parents;
+
+	// Chi-sets (hypergraph nodes) and lambda-sets (hypergraph edges) of the tree nodes as ascending
+	// lists; the lists of tree node i start at position ChiStart[i] and LambdaStart[i], respectively
+	vector<int> ChiStart, Chi;
+	vector<int> LambdaStart, Lambda;
+};
+
+class Decomposer
+{
+private:
+	// Hypergraph as edge lists (the nodes of each edge in ascending order)
+	int iMyNbrOfEdges, iMyNbrOfNodes;
+	vector<int> MyEdgeNodeStart, MyEdgeNodes;
+
+	// Names of the edges and nodes (owned by MyHGraph)
+	vector<char *> MyEdgeNames, MyNodeNames;
+
+	// Hypergraph used by searches in the calling thread
+	Hypergraph *MyHGraph;
+
+	// Number of threads used by optimize, deadline in milliseconds (0 if unlimited), and whether
+	// results of previous searches are reused
+	int iMyNbrOfThreads;
+	long long lMyDeadline;
+	bool bMyCache;
+
+	// Seed of the random number generator used by each search
+	unsigned int iMySeed;
+
+	// Largest width for which no decomposition exists (0 if unknown) and decomposition of smallest
+	// width found so far (iWidth is 0 if there is none); only maintained if bMyCache is set
+	int iMyFailedK;
+	DecompTree MyBest;
+
+	// Result and statistics of the last search; times in nanoseconds
+	int iMyStatus;
+	DecompTree MyResult;
+	long long lMyNbrOfCalls, lMyNbrOfSeps, lMyNbrOfCutParts;
+	long long lMyLoadTime, lMyDecompTime;
+
+	// State of the widths tested concurrently by optimize: next and last width to be tested, smallest
+	// width for which a decomposition was found (0 if none) and this decomposition, largest width for
+	// which none exists, smallest width for which a test was stopped, and the running tests together
+	// with their stop flags
+	mutex MyMutex;
+	int iMyNextK, iMyMaxK, iMyFoundK, iMyMaxFailedK, iMyMinStoppedK;
+	DecompTree MyFound;
+	list<pair<int, atomic<bool> *> > MyRunningTests;
+	string MyWorkerError;
+
+	// Flag set by stop to end the running decompose or optimize
+	atomic<bool> bMyStop;
+
+	// Replaces the hypergraph and resets the cache
+	void setHGraph(Hypergraph *HGraph);
+
+	// Returns the number of milliseconds left until the deadline (0 if unlimited, -1 if exceeded)
+	long long getTimeLeft(long long lStart);
+
+	// Searches for a decomposition of width at most iK
+	int search(Hypergraph *HGraph, int iK, long long lTimeLimit, const atomic<bool> *StopFlag, DecompTree *Tree);
+
+	// Tests widths for optimize until the optimal width is known
+	void runOptimizeWorker(long long lStart, bool bOwnHGraph);
+
+	// Stores the heuristic decomposition as result after a search was stopped
+	void setHeuristicResult();
+
+	// Stores the result of a search and updates the cache
+	int setResult(int iStatus, int iK, DecompTree *Tree);
+
+public:
+	// Constructor
+	Decomposer();
+
+	// Destructor
+	virtual ~Decomposer();
+
+	// Sets the hypergraph given by edge lists (at least one edge)
+	void setHypergraph(int iNbrOfEdges, int iNbrOfNodes, const int *EdgeNodeStart, const int *EdgeNodes);
+
+	// Loads the hypergraph from a file in text, binary, or PACE format
+	void loadFile(const char *cNameOfFile, bool bDef);
+
+	// Returns the number of edges of the hypergraph
+	int getNbrOfEdges();
+
+	// Returns the number of nodes of the hypergraph
+	int getNbrOfNodes();
+
+	// Returns the name of an edge of the hypergraph
+	const char *getEdgeName(int iEdge);
+
+	// Returns the name of a node of the hypergraph
+	const char *getNodeName(int iNode);
+
+	// Sets *Nodes to the ascending list of nodes of an edge and returns its size (-1 if the edge
+	// does not exist)
+	int getEdgeNodes(int iEdge, const int **Nodes);
+
+	// Sets the number of threads used by optimize
+	void setThreads(int iNbrOfThreads);
+
+	// Sets the number of seconds after which a search is stopped (0 if unlimited)
+	void setDeadline(int iSeconds);
+
+	// Sets the number of milliseconds after which a search is stopped (0 if unlimited)
+	void setDeadlineMs(long long lMilliseconds);
+
+	// Enables or disables the reuse of results of previous searches
+	void setCache(bool bCache);
+
+	// Sets the seed of the random order of the hyperedges (1 by default)
+	void setSeed(unsigned int iSeed);
+
+	// Searches for a decomposition of width at most iK; returns DK_FOUND, DK_NOT_FOUND, or DK_STOPPED
+	int decompose(int iK);
+
+	// Searches for a decomposition of minimal width (at most iMaxK if iMaxK > 0)
+	int optimize(int iMaxK = 0);
+
+	// Stops the running decompose or optimize, which then return DK_STOPPED; may be called from
+	// another thread
+	void stop();
+
+	// Returns the result of the last search
+	int getStatus();
+	const DecompTree *getResult();
+
+	// Returns the number of decomp calls, examined separators, and pruned components of the last search
+	long long getNbrOfCalls();
+	long long getNbrOfSeps();
+	long long getNbrOfCutParts();
+
+	// Returns the time in nanoseconds for loading the hypergraph and for the last search
+	long long getLoadTime();
+	long long getDecompTime();
+};
+
+
+#endif // !defined(CLS_DECOMPOSER)
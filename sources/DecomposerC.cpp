@@ -0,0 +1,268 @@
+// DecomposerC.cpp: implementation of the C interface of the Decomposer class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+#include "DecomposerC.h"
+#include "Decomposer.h"
+
+
+// Decomposer together with the message of the last error
+struct dk_decomposer
+{
+	Decomposer D;
+	string Error;
+};
+
+
+// Stores the message of an exception and returns DK_ERROR
+static int setError(dk_decomposer *D, exception &E)
+{
+	D->Error = E.what();
+	return DK_ERROR;
+}
+
+
+// Checks whether a tree node of the resulting decomposition exists
+static bool isTreeNode(dk_decomposer *D, int iTreeNode)
+{
+	return (iTreeNode >= 0) && (iTreeNode < (int)D->D.getResult()->Parents.size());
+}
+
+
+dk_decomposer *dk_create(void)
+{
+	return new (nothrow) dk_decomposer;
+}
+
+
+void dk_destroy(dk_decomposer *D)
+{
+	delete D;
+}
+
+
+int dk_api_version(void)
+{
+	return DK_API_VERSION;
+}
+
+
+int dk_set_hypergraph(dk_decomposer *D, int iNbrOfEdges, int iNbrOfNodes, const int *EdgeNodeStart, const int *EdgeNodes)
+{
+	D->Error.clear();
+	try {
+		D->D.setHypergraph(iNbrOfEdges, iNbrOfNodes, EdgeNodeStart, EdgeNodes);
+	}
+	catch(exception &E) {
+		return setError(D, E);
+	}
+
+	return 0;
+}
+
+
+int dk_load_file(dk_decomposer *D, const char *cNameOfFile, int bDef)
+{
+	D->Error.clear();
+	try {
+		D->D.loadFile(cNameOfFile, bDef != 0);
+	}
+	catch(exception &E) {
+		return setError(D, E);
+	}
+
+	return 0;
+}
+
+
+int dk_get_nbr_of_edges(dk_decomposer *D)
+{
+	return D->D.getNbrOfEdges();
+}
+
+
+int dk_get_nbr_of_nodes(dk_decomposer *D)
+{
+	return D->D.getNbrOfNodes();
+}
+
+
+const char *dk_get_edge_name(dk_decomposer *D, int iEdge)
+{
+	return D->D.getEdgeName(iEdge);
+}
+
+
+const char *dk_get_node_name(dk_decomposer *D, int iNode)
+{
+	return D->D.getNodeName(iNode);
+}
+
+
+int dk_get_edge_nodes(dk_decomposer *D, int iEdge, const int **Nodes)
+{
+	int iSize = D->D.getEdgeNodes(iEdge, Nodes);
+
+	if(iSize < 0) {
+		D->Error = "Illegal edge.";
+		return DK_ERROR;
+	}
+
+	return iSize;
+}
+
+
+void dk_set_threads(dk_decomposer *D, int iNbrOfThreads)
+{
+	D->D.setThreads(iNbrOfThreads);
+}
+
+
+void dk_set_deadline(dk_decomposer *D, int iSeconds)
+{
+	D->D.setDeadline(iSeconds);
+}
+
+
+void dk_set_deadline_ms(dk_decomposer *D, long long lMilliseconds)
+{
+	D->D.setDeadlineMs(lMilliseconds);
+}
+
+
+void dk_set_cache(dk_decomposer *D, int bCache)
+{
+	D->D.setCache(bCache != 0);
+}
+
+
+void dk_set_seed(dk_decomposer *D, unsigned int iSeed)
+{
+	D->D.setSeed(iSeed);
+}
+
+
+int dk_decompose(dk_decomposer *D, int iK)
+{
+	D->Error.clear();
+	try {
+		return D->D.decompose(iK);
+	}
+	catch(exception &E) {
+		return setError(D, E);
+	}
+}
+
+
+int dk_optimize(dk_decomposer *D, int iMaxK)
+{
+	D->Error.clear();
+	try {
+		return D->D.optimize(iMaxK);
+	}
+	catch(exception &E) {
+		return setError(D, E);
+	}
+}
+
+
+void dk_stop(dk_decomposer *D)
+{
+	D->D.stop();
+}
+
+
+int dk_get_width(dk_decomposer *D)
+{
+	return D->D.getResult()->iWidth;
+}
+
+
+int dk_get_tree_size(dk_decomposer *D)
+{
+	return (int)D->D.getResult()->Parents.size();
+}
+
+
+int dk_get_parent(dk_decomposer *D, int iTreeNode)
+{
+	if(!isTreeNode(D, iTreeNode)) {
+		D->Error = "Illegal tree node.";
+		return DK_ERROR;
+	}
+
+	return D->D.getResult()->Parents[iTreeNode];
+}
+
+
+int dk_get_chi(dk_decomposer *D, int iTreeNode, const int **Nodes)
+{
+	const DecompTree *Tree = D->D.getResult();
+
+	if(!isTreeNode(D, iTreeNode)) {
+		D->Error = "Illegal tree node.";
+		return DK_ERROR;
+	}
+	*Nodes = Tree->Chi.data() + Tree->ChiStart[iTreeNode];
+
+	return Tree->ChiStart[iTreeNode+1] - Tree->ChiStart[iTreeNode];
+}
+
+
+int dk_get_lambda(dk_decomposer *D, int iTreeNode, const int **Edges)
+{
+	const DecompTree *Tree = D->D.getResult();
+
+	if(!isTreeNode(D, iTreeNode)) {
+		D->Error = "Illegal tree node.";
+		return DK_ERROR;
+	}
+	*Edges = Tree->Lambda.data() + Tree->LambdaStart[iTreeNode];
+
+	return Tree->LambdaStart[iTreeNode+1] - Tree->LambdaStart[iTreeNode];
+}
+
+
+long long dk_get_nbr_of_calls(dk_decomposer *D)
+{
+	return D->D.getNbrOfCalls();
+}
+
+
+long long dk_get_nbr_of_seps(dk_decomposer *D)
+{
+	return D->D.getNbrOfSeps();
+}
+
+
+long long dk_get_nbr_of_cut_parts(dk_decomposer *D)
+{
+	return D->D.getNbrOfCutParts();
+}
+
+
+long long dk_get_load_time(dk_decomposer *D)
+{
+	return D->D.getLoadTime();
+}
+
+
+long long dk_get_decomp_time(dk_decomposer *D)
+{
+	return D->D.getDecompTime();
+}
+
+
+const char *dk_get_error(dk_decomposer *D)
+{
+	return D->Error.c_str();
+}
@@ -0,0 +1,120 @@
+/* Stable C interface of the det-k-decomp library (see Decomposer.h for the C++ interface).
+ *
+ * A hypergraph with E edges and N nodes is given by the nodes of its edges: the nodes of edge e
+ * are EdgeNodes[EdgeNodeStart[e]], ..., EdgeNodes[EdgeNodeStart[e+1]-1], where the nodes are
+ * numbered 0, ..., N-1. A decomposition is a tree whose nodes are numbered 0, ..., T-1 in
+ * depth-first order such that node 0 is the root and each node has a smaller number than its
+ * children; each tree node has a chi-set of hypergraph nodes and a lambda-set of hypergraph edges.
+ *
+ * All functions returning int return DK_ERROR on errors; the message of the last error can be
+ * obtained by dk_get_error. A decomposer must not be used by several threads at the same time, except
+that dk_stop may be called while another thread runs dk_decompose or dk_optimize.
+ */
+
+
+#if !defined(CLS_DECOMPOSERC)
+#define CLS_DECOMPOSERC
+
+
+#define DK_ERROR -1
+#define DK_NOT_FOUND 0
+#define DK_FOUND 1
+#define DK_STOPPED 2
+
+#define DK_API_VERSION 2
+
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+typedef struct dk_decomposer dk_decomposer;
+
+/* Creates a decomposer; returns NULL if no memory is available */
+dk_decomposer *dk_create(void);
+
+/* Destroys a decomposer and all results */
+void dk_destroy(dk_decomposer *D);
+
+/* Returns DK_API_VERSION of the library */
+int dk_api_version(void);
+
+/* Sets the hypergraph given by edge lists; returns 0 on success and DK_ERROR for a hypergraph
+   without edges, which has no decomposition to search for */
+int dk_set_hypergraph(dk_decomposer *D, int iNbrOfEdges, int iNbrOfNodes, const int *EdgeNodeStart, const int *EdgeNodes);
+
+/* Loads the hypergraph from a file in text, binary, or PACE format; returns 0 on success and
+   DK_ERROR for a file without edges */
+int dk_load_file(dk_decomposer *D, const char *cNameOfFile, int bDef);
+
+/* Returns the number of edges and nodes of the hypergraph */
+int dk_get_nbr_of_edges(dk_decomposer *D);
+int dk_get_nbr_of_nodes(dk_decomposer *D);
+
+/* Returns the name of an edge or node of the hypergraph (NULL if it does not exist) */
+const char *dk_get_edge_name(dk_decomposer *D, int iEdge);
+const char *dk_get_node_name(dk_decomposer *D, int iNode);
+
+/* Sets *Nodes to the ascending list of nodes of an edge of the hypergraph and returns its size */
+int dk_get_edge_nodes(dk_decomposer *D, int iEdge, const int **Nodes);
+
+/* Sets the number of threads used by dk_optimize (default 1) */
+void dk_set_threads(dk_decomposer *D, int iNbrOfThreads);
+
+/* Sets the number of seconds after which a search is stopped (0 if unlimited, the default) */
+void dk_set_deadline(dk_decomposer *D, int iSeconds);
+
+/* Sets the number of milliseconds after which a search is stopped (0 if unlimited) */
+void dk_set_deadline_ms(dk_decomposer *D, long long lMilliseconds);
+
+/* Enables or disables the reuse of results of previous searches on the same hypergraph (default on) */
+void dk_set_cache(dk_decomposer *D, int bCache);
+
+/* Sets the seed of the random order of the hyperedges used by each search (default 1) */
+void dk_set_seed(dk_decomposer *D, unsigned int iSeed);
+
+/* Searches for a decomposition of width at most k; returns DK_FOUND, DK_NOT_FOUND, or DK_STOPPED
+   (the deadline was exceeded or dk_stop was called, and the result is a heuristic decomposition of
+   possibly larger width) */
+int dk_decompose(dk_decomposer *D, int iK);
+
+/* Searches for a decomposition of minimal width (at most iMaxK if iMaxK > 0) */
+int dk_optimize(dk_decomposer *D, int iMaxK);
+
+/* Stops the dk_decompose or dk_optimize running in another thread, which then returns DK_STOPPED
+   with the best decomposition found so far; has no effect if no search is running */
+void dk_stop(dk_decomposer *D);
+
+/* Returns the width of the resulting decomposition (0 if there is none) */
+int dk_get_width(dk_decomposer *D);
+
+/* Returns the number of tree nodes of the resulting decomposition (0 if there is none) */
+int dk_get_tree_size(dk_decomposer *D);
+
+/* Returns the parent of a tree node (-1 for the root) */
+int dk_get_parent(dk_decomposer *D, int iTreeNode);
+
+/* Sets *Nodes to the ascending chi-set of a tree node and returns its size */
+int dk_get_chi(dk_decomposer *D, int iTreeNode, const int **Nodes);
+
+/* Sets *Edges to the ascending lambda-set of a tree node and returns its size */
+int dk_get_lambda(dk_decomposer *D, int iTreeNode, const int **Edges);
+
+/* Returns the number of decomp calls, examined separators, and pruned components of the last search */
+long long dk_get_nbr_of_calls(dk_decomposer *D);
+long long dk_get_nbr_of_seps(dk_decomposer *D);
+long long dk_get_nbr_of_cut_parts(dk_decomposer *D);
+
+/* Returns the time in nanoseconds for loading the hypergraph and for the last search */
+long long dk_get_load_time(dk_decomposer *D);
+long long dk_get_decomp_time(dk_decomposer *D);
+
+/* Returns the message of the last error (empty if there was no error) */
+const char *dk_get_error(dk_decomposer *D);
+
+#if defined(__cplusplus)
+}
+#endif
+
+
+#endif /* !defined(CLS_DECOMPOSERC) */
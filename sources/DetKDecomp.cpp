@@ -4,12 +4,17 @@
 
 
 #include <cstdio>
+#include <cstring>
 #include <iostream>
 #include <cmath>
 #include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
 
 #include <list>
 #include <vector>
+#include <map>
 
 using namespace std;
 
@@ -19,6 +24,60 @@ using namespace std;
 #include "Hyperedge.h"
 #include "Node.h"
 #include "Globals.h"
+#include "SearchProfile.h"
+#include "TraceWriter.h"
+#include "MemoryAccount.h"
+
+
+// Identification of checkpoint files ("DKCP") and version of their format
+#define CHECKPOINT_MAGIC 0x50434B44
+#define CHECKPOINT_VERSION 1
+
+// Identification of record files and version of their format
+#define RECORD_HEADER "detkdecomp-record"
+#define RECORD_VERSION 1
+
+
+/*
+***Description***
+The function returns the next value of a checkpoint and exits if the checkpoint is truncated.
+
+INPUT:	Data: Values of the checkpoint
+		iPos: Position of the next value
+OUTPUT: iPos: Position of the following value
+		return: Next value
+*/
+
+static int nextCheckpointValue(vector<int> *Data, int *iPos)
+{
+	if(*iPos >= (int)Data->size())
+		writeErrorMsg("Invalid checkpoint file.", "nextCheckpointValue");
+
+	return (*Data)[(*iPos)++];
+}
+
+
+/*
+***Description***
+The function returns the hyperedge identified by the next value of a checkpoint.
+
+INPUT:	Data: Values of the checkpoint
+		iPos: Position of the next value
+		EdgeByID: Hyperedges indexed by their IDs
+		iNbrOfEdges: Number of hyperedges in EdgeByID
+OUTPUT: iPos: Position of the following value
+		return: Hyperedge identified by the next value
+*/
+
+static Hyperedge *nextCheckpointEdge(vector<int> *Data, int *iPos, Hyperedge **EdgeByID, int iNbrOfEdges)
+{
+	int iID = nextCheckpointValue(Data, iPos);
+
+	if((iID < 0) || (iID >= iNbrOfEdges))
+		writeErrorMsg("Invalid checkpoint file.", "nextCheckpointEdge");
+
+	return EdgeByID[iID];
+}
 
 
 
@@ -30,7 +89,27 @@ using namespace std;
 DetKDecomp::DetKDecomp()
 {
 	MyHGraph = NULL;
+	MyLastSep = NULL;
+	MyResult = NULL;
+	cMyCheckpointFile = NULL;
+	iMyCheckpointInterval = 0;
+	cMyResumeFile = NULL;
+	iMyResumePos = 0;
+	cMyRecordFile = cMyReplayFile = NULL;
+	iMyReplayPos = 0;
+	lMyTimeLimit = 0;
+	bMyStopped = false;
+	MyStopFlag = NULL;
+	bMyVerbose = true;
+	lMyNbrOfCalls = lMyNbrOfSeps = lMyNbrOfCutParts = 0;
+	lMyOrderTime = lMySearchTime = lMyExpandTime = 0;
+	MyProfile = NULL;
+	MyProgressOut = NULL;
+	iMyProgressInterval = 0;
+	lMyProgressCalls = 0;
+	MyTrace = NULL;
 	iMyK = 0;
+	lMyMemoBytes = lMyPartBytes = 0;
 }
 
 
@@ -62,6 +141,7 @@ OUTPUT: Set: Selection of hyperedges in Edges such that all nodes in Nodes are c
 int DetKDecomp::setInitSubset(Node **Nodes, Hyperedge **Edges, int *Set, bool *bInComp, int *CovWeights, int iSize)
 {
 	int iUncov, iWeight, i, j;
+	long long lTraceStart;
 
 	// Reset node labels
 	MyHGraph->resetNodeLabels(-1);
@@ -91,7 +171,13 @@ int DetKDecomp::setInitSubset(Node **Nodes, Hyperedge **Edges, int *Set, bool *b
 	}
 
 	// Select an initial subset of at most iMyK hyperedges
-	return coverNodes(Edges, Set, bInComp, CovWeights, iSize, iUncov, false);
+	if(!MyStack.back()->bTraced)
+		return coverNodes(Edges, Set, bInComp, CovWeights, iSize, iUncov, false);
+	lTraceStart = MyTrace->now();
+	i = coverNodes(Edges, Set, bInComp, CovWeights, iSize, iUncov, false);
+	MyTrace->writeSpan("coverNodes", lTraceStart);
+
+	return i;
 }
 
 
@@ -112,14 +198,21 @@ OUTPUT: Set: Selection of hyperedges in Edges such that all nodes in Nodes are c
 
 int DetKDecomp::setNextSubset(Node **Nodes, Hyperedge **Edges, int *Set, bool *bInComp, int *CovWeights, int iSize)
 {
-	int iUncov;
+	int iUncov, iNbrSel;
+	long long lTraceStart;
 
 	MyHGraph->resetNodeLabels(-1);
 	for(iUncov=0; Nodes[iUncov] != NULL; iUncov++)
 		Nodes[iUncov]->setLabel(0);
 
 	// Select the next subset of at most iMyK hyperedges
-	return coverNodes(Edges, Set, bInComp, CovWeights, iSize, iUncov, true);
+	if(!MyStack.back()->bTraced)
+		return coverNodes(Edges, Set, bInComp, CovWeights, iSize, iUncov, true);
+	lTraceStart = MyTrace->now();
+	iNbrSel = coverNodes(Edges, Set, bInComp, CovWeights, iSize, iUncov, true);
+	MyTrace->writeSpan("coverNodes", lTraceStart);
+
+	return iNbrSel;
 }
 
 
@@ -197,6 +290,8 @@ int DetKDecomp::coverNodes(Hyperedge **Edges, int *Set, bool *bInComp, int *CovW
 				else
 					iWeight = 0;
 			if((iWeight < iUncovered) || (iWeight == 0)) {
+				if(MyProfile != NULL)
+					++MyProfile->getLevel(MyStack.back()->iRecLevel)->lCoverPrunes;
 				bBack = true;
 				break;
 			}
@@ -388,6 +483,7 @@ int DetKDecomp::separate(Hyperedge **HEdges, Hyperedge ****Partitions, Node ****
 	list<Node *>::iterator NIter1;
 	list<Node **>::iterator NIter2;
 
+	lMyPartBytes = 0;
 	for(i=0; HEdges[i] != NULL; i++)
 		if(HEdges[i]->getLabel() == 0) {
 			Edges.clear();
@@ -416,6 +512,7 @@ int DetKDecomp::separate(Hyperedge **HEdges, Hyperedge ****Partitions, Node ****
 
 			Parts.push_back(Part);
 			Conns.push_back(Conn);
+			lMyPartBytes += (long long)(Edges.size()+Connector.size()+2)*sizeof(void *);
 		}
 
 	*Partitions = new Hyperedge**[Parts.size()+1];
@@ -430,6 +527,7 @@ int DetKDecomp::separate(Hyperedge **HEdges, Hyperedge ****Partitions, Node ****
 	}
 	(*Partitions)[i] = NULL;
 	(*Connectors)[i] = NULL;
+	lMyPartBytes += (long long)(2*i+2)*sizeof(void *);
 
 	return i;
 }
@@ -621,19 +719,22 @@ are labeled by -1 and no other hyperedges are labeled by -1.
 INPUT:	iSepSize: Size of the actual separator
 OUTPUT: Separator: Stored separator
 		SuccParts: List of decomposable partitions
+		SuccSeps: List of separators chosen for the decomposable partitions
 		FailParts: List of undecomposable partitions
 		return: true if separator was found; otherwise false
 */
 
-bool DetKDecomp::getSepParts(int iSepSize, Hyperedge ***Separator, list<Hyperedge *> **SuccParts, list<Hyperedge *> **FailParts)
+bool DetKDecomp::getSepParts(int iSepSize, Hyperedge ***Separator, list<Hyperedge *> **SuccParts, list<Hyperedge **> **SuccSeps, list<Hyperedge *> **FailParts)
 {
 	int i;
 	bool bFound = false;
 	list<Hyperedge **>::iterator SepIter;
 	list<list<Hyperedge *> *>::iterator SuccPartIter, FailPartIter;
+	list<list<Hyperedge **> *>::iterator SuccSepIter;
 
 	// Check whether the actual separator is known to be decomposable or undecomposable
 	SuccPartIter = MySuccSepParts.begin();
+	SuccSepIter = MySuccSepChoices.begin();
 	FailPartIter = MyFailSepParts.begin();
 	for(SepIter=MySeps.begin(); SepIter != MySeps.end(); SepIter++) {
 		bFound = true;
@@ -646,11 +747,13 @@ bool DetKDecomp::getSepParts(int iSepSize, Hyperedge ***Separator, list<Hyperedg
 		if(bFound && (i == iSepSize)) {
 			*Separator = *SepIter;
 			*SuccParts = *SuccPartIter;
+			*SuccSeps = *SuccSepIter;
 			*FailParts = *FailPartIter;
 			return true;
 		}
 
 		++SuccPartIter;
+		++SuccSepIter;
 		++FailPartIter;
 	}
 
@@ -658,6 +761,96 @@ bool DetKDecomp::getSepParts(int iSepSize, Hyperedge ***Separator, list<Hyperedg
 }
 
 
+/*
+***Description***
+The method searches in the list of successfully decomposed partitions of a separator for
+the partition with a given label and returns the separator that was chosen at its root.
+
+INPUT:	SuccParts: List of decomposable partitions
+		SuccSeps: List of separators chosen for the decomposable partitions
+		iLabel: Label
+OUTPUT: Separator: Separator chosen for the partition labeled by iLabel (NULL if the partition
+		was decomposed without separator)
+		return: true if there exists a partition in SuccParts labeled by iLabel; otherwise false
+*/
+
+bool DetKDecomp::getSuccSep(list<Hyperedge *> *SuccParts, list<Hyperedge **> *SuccSeps, int iLabel, Hyperedge ***Separator)
+{
+	list<Hyperedge *>::iterator PartIter;
+	list<Hyperedge **>::iterator SepIter;
+
+	// Search for a partition labeled by iLabel
+	for(PartIter=SuccParts->begin(), SepIter=SuccSeps->begin(); PartIter != SuccParts->end(); PartIter++, SepIter++)
+		if((*PartIter)->getLabel() == iLabel) {
+			*Separator = *SepIter;
+			return true;
+		}
+
+	return false;
+}
+
+
+/*
+***Description***
+The method deletes the separators already used together with their lists of decomposable and
+undecomposable partitions and the separators chosen for the decomposable partitions.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void DetKDecomp::clearSeps()
+{
+	list<Hyperedge **>::iterator ListIter;
+	list<list<Hyperedge *> *>::iterator ListIter1, ListIter2;
+	list<list<Hyperedge **> *>::iterator ListIter3;
+
+	for(ListIter=MySeps.begin(); ListIter != MySeps.end(); ListIter++)
+		delete [] *ListIter;
+	MySeps.clear();
+
+	for(ListIter1=MySuccSepParts.begin(), ListIter2=MyFailSepParts.begin(), ListIter3=MySuccSepChoices.begin(); ListIter1 != MySuccSepParts.end(); ListIter1++, ListIter2++, ListIter3++) {
+		delete *ListIter1;
+		delete *ListIter2;
+		delete *ListIter3;
+	}
+	MySuccSepParts.clear();
+	MyFailSepParts.clear();
+	MySuccSepChoices.clear();
+
+	MemoryAccount::sub(MEM_MEMO, lMyMemoBytes);
+	lMyMemoBytes = 0;
+}
+
+
+void DetKDecomp::accountMemo(long long lBytes)
+{
+	lMyMemoBytes += lBytes;
+	MemoryAccount::add(MEM_MEMO, lBytes);
+}
+
+
+/*
+***Description***
+The method removes the bytes of the partitions and connectors of a decomp call and, unless only 
+the partitions are released, the bytes of the frame and its auxiliary arrays from the memory 
+account.
+
+INPUT:	Frame: Frame of the decomp call
+		bPartsOnly: true if only the partitions are released
+*/
+
+void DetKDecomp::releaseFrame(DecompFrame *Frame, bool bPartsOnly)
+{
+	MemoryAccount::sub(MEM_SEARCH, Frame->lPartBytes);
+	Frame->lPartBytes = 0;
+	if(!bPartsOnly) {
+		MemoryAccount::sub(MEM_SEARCH, Frame->lBytes);
+		Frame->lBytes = 0;
+	}
+}
+
+
 /*
 ***Description***
 The method searches in a list of hyperedges for an edge with a given label.
@@ -714,10 +907,513 @@ bool DetKDecomp::isSplitSep(Node **Connector, Node ***ChildConnectors)
 }
 
 
+/*
+***Description***
+The method pushes a new decomp call onto the explicit search stack. The call is executed by
+subsequent invocations of step().
+
+INPUT:	HEdges: Hyperedges in the subgraph
+		Connector: Connector nodes that must be covered
+		iRecLevel: Recursion level
+*/
+
+void DetKDecomp::pushFrame(Hyperedge **HEdges, Node **Connector, int iRecLevel)
+{
+	DecompFrame *Frame;
+
+	Frame = new DecompFrame;
+	if(Frame == NULL)
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::pushFrame");
+
+	Frame->iState = DS_ENTER;
+	Frame->HEdges = HEdges;
+	Frame->Connector = Connector;
+	Frame->iRecLevel = iRecLevel;
+	Frame->iAddEdge = Frame->iAddSize = 0;
+	Frame->bResume = false;
+	Frame->bTraced = false;
+	Frame->HTree = NULL;
+	Frame->lBytes = sizeof(DecompFrame);
+	Frame->lPartBytes = 0;
+	MemoryAccount::add(MEM_SEARCH, Frame->lBytes);
+
+	MyStack.push_back(Frame);
+	++lMyNbrOfCalls;
+}
+
+
+/*
+***Description***
+The method executes the next step of the decomp call on top of the explicit search stack as 
+described in Gottlob and Samer: A Backtracking-Based Algorithm for Computing 
+Hypertree-Decompositions. Each step ends at a position in the body of the decomp call at which
+no labels of nodes or hyperedges have to be preserved; the search can thus be suspended 
+between two steps. A decomp call on a component is started by pushing a new frame; when it 
+finishes, its frame is removed and the result is passed to the calling frame.
+
+INPUT:	iBaseDepth: Stack depth of the outermost decomp call to be executed
+OUTPUT: return: true if the outermost decomp call finished; its result is stored in MyResult
+*/
+
+bool DetKDecomp::step(int iBaseDepth)
+{
+	int iNbrOfNodes, iPartSize, i, j;
+	long long lTraceStart, lBytes;
+	bool bReusedSep, bFailSep;
+	Hyperedge *Edge, **Half;
+	list<Hypertree *>::iterator TreeIter;
+	ProfileLevel *Level;
+	DecompFrame *F = MyStack.back();
+
+	switch(F->iState) {
+		case DS_ENTER:
+			for(F->iNbrOfEdges=0; F->HEdges[F->iNbrOfEdges] != NULL; F->iNbrOfEdges++);
+			if(MyProfile != NULL) {
+				Level = MyProfile->getLevel(F->iRecLevel);
+				++Level->lCalls;
+				Level->lCompEdges += F->iNbrOfEdges;
+				if(F->iNbrOfEdges > Level->iMaxCompEdges)
+					Level->iMaxCompEdges = F->iNbrOfEdges;
+			}
+			if(MyTrace != NULL) {
+				for(i=0; F->Connector[i] != NULL; i++);
+				F->bTraced = MyTrace->beginDecomp(F->iRecLevel, F->iNbrOfEdges, i);
+			}
+
+			// Stop if the hypergraph can be decomposed into two hypertree-nodes
+			if((F->Connector[0] == NULL) && (F->iNbrOfEdges > 1) && ((int)ceil(F->iNbrOfEdges/2.0) <= iMyK)) {
+				for(i=0; i < F->iNbrOfEdges; i++)
+					F->HEdges[i]->setLabel(-1);
+				i = F->iNbrOfEdges / 2;
+				F->HTree = getHTNode(&F->HEdges[i], NULL, NULL);
+
+				// The first half is copied such that the hyperedges of the caller are not truncated
+				Half = new Hyperedge*[i+1];
+				if(Half == NULL)
+					writeErrorMsg("Error assigning memory.", "DetKDecomp::step");
+				for(j=0; j < i; j++)
+					Half[j] = F->HEdges[j];
+				Half[i] = NULL;
+				F->HTree->insChild(getHTNode(Half, NULL, NULL));
+				delete [] Half;
+				MyLastSep = NULL;
+				break;
+			}
+
+			// Stop if the hypergraph can be decomposed into a single hypertree-node
+			if(F->iNbrOfEdges <= iMyK) {
+				for(i=0; i < F->iNbrOfEdges; i++)
+					F->HEdges[i]->setLabel(-1);
+				MyLastSep = NULL;
+				F->HTree = getHTNode(F->HEdges, F->Connector, NULL);
+				break;
+			}
+
+			// Divide hyperedges into inner hyperedges and hyperedges containing some connecting nodes
+			lTraceStart = F->bTraced ? MyTrace->now() : 0;
+			F->iCompEnd = divideCompEdges(F->HEdges, F->Connector, &F->InnerEdges, &F->BoundEdges);
+			if(F->bTraced)
+				MyTrace->writeSpan("divideCompEdges", lTraceStart);
+
+			// Count the number of inner and boundary hyperedges
+			for(F->iInnerSize=0; F->InnerEdges[F->iInnerSize] != NULL; F->iInnerSize++);
+			for(F->iBoundSize=0; F->BoundEdges[F->iBoundSize] != NULL; F->iBoundSize++);
+
+			// Create auxiliary arrays
+			F->CovSepSet = new int[iMyK+1];
+			F->bInComp = new bool[F->iBoundSize];
+			F->CovWeights = new int[F->iBoundSize];
+			F->AddEdges = new Hyperedge*[F->iInnerSize+F->iCompEnd+1];
+			if((F->CovSepSet == NULL) || (F->bInComp == NULL) || (F->CovWeights == NULL) || (F->AddEdges == NULL))
+				writeErrorMsg("Error assigning memory.", "DetKDecomp::step");
+			lBytes = (long long)(F->iInnerSize+F->iBoundSize+2 + F->iInnerSize+F->iCompEnd+1)*sizeof(Hyperedge *);
+			lBytes += (long long)(iMyK+1 + F->iBoundSize)*sizeof(int) + F->iBoundSize*sizeof(bool);
+			F->lBytes += lBytes;
+			MemoryAccount::add(MEM_SEARCH, lBytes);
+
+			// Initialize bInComp array
+			for(i=0; i < F->iBoundSize; i++)
+				i < F->iCompEnd ? F->bInComp[i] = true : F->bInComp[i] = false;
+
+			// Select initial hyperedges to cover the connecting nodes
+			F->iNbrSelCov = setInitSubset(F->Connector, F->BoundEdges, F->CovSepSet, F->bInComp, F->CovWeights, F->iBoundSize);
+			if((MyProfile != NULL) && (F->iNbrSelCov >= 0))
+				++MyProfile->getLevel(F->iRecLevel)->lCovers;
+
+			// Initialize AddEdges array
+			F->iAddSize = 0;
+			for(i=0; i < F->iBoundSize; i++)
+				if(F->bInComp[i])
+					F->AddEdges[F->iAddSize++] = F->BoundEdges[i];
+			for(i=0; i < F->iInnerSize; i++)
+				F->AddEdges[F->iAddSize++] = F->InnerEdges[i];
+			F->AddEdges[F->iAddSize] = NULL;
+			if(F->iAddSize <= 0)
+				writeErrorMsg("Illegal number of hyperedges.", "DetKDecomp::step");
+
+			// Continue with the selection stored in a checkpoint
+			if((iMyResumePos < (int)MyResume.size()) && (iMyResumePos == (int)MyStack.size()-1))
+				restoreFrame(F);
+
+			F->iState = F->iNbrSelCov >= 0 ? DS_COVER : DS_FINISH;
+			return false;
+
+		case DS_COVER:
+			// Check whether a covering hyperedge within the component was selected
+			F->bAddEdge = true;
+			for(i=0; i < F->iNbrSelCov; i++)
+				if(F->bInComp[F->CovSepSet[i]]) {
+					F->bAddEdge = false;
+					break;
+				}
+
+			// Stop if no inner hyperedge can be in the separator
+			if(!F->bAddEdge || (iMyK-F->iNbrSelCov > 0)) {
+				if(!F->bResume)
+					F->iAddEdge = 0;
+				F->bAddEdge ? F->iSepSize = F->iNbrSelCov+1 : F->iSepSize = F->iNbrSelCov;
+				F->iState = DS_SEPARATE;
+			}
+			else
+				F->iState = DS_NEXT_COVER;
+			F->bResume = false;
+			return false;
+
+		case DS_SEPARATE:
+			++lMyNbrOfSeps;
+			if(MyProfile != NULL)
+				++MyProfile->getLevel(F->iRecLevel)->lSeps;
+
+			// Set labels of separating nodes and hyperedges to -1
+			MyHGraph->resetEdgeLabels();
+			MyHGraph->resetNodeLabels();
+			for(i=0; i < F->iNbrSelCov; i++) {
+				Edge = F->BoundEdges[F->CovSepSet[i]];
+				Edge->setLabel(-1);
+				iNbrOfNodes = Edge->getNbrOfNodes();
+				for(j=0; j < iNbrOfNodes; j++)
+					Edge->getNode(j)->setLabel(-1);
+			}
+			if(F->bAddEdge) {
+				Edge = F->AddEdges[F->iAddEdge];
+				Edge->setLabel(-1);
+				iNbrOfNodes = Edge->getNbrOfNodes();
+				for(j=0; j < iNbrOfNodes; j++)
+					Edge->getNode(j)->setLabel(-1);
+			}
+
+			// Check if selected hyperedges were already used before as separator
+			bReusedSep = getSepParts(F->iSepSize, &F->Separator, &F->SuccParts, &F->SuccSeps, &F->FailParts);
+			if(MyProfile != NULL) {
+				Level = MyProfile->getLevel(F->iRecLevel);
+				bReusedSep ? ++Level->lSepHits : ++Level->lSepMisses;
+			}
+			if(!bReusedSep) {
+				// Create a separator array and lists for decomposable and undecomposable parts
+				F->Separator = new Hyperedge*[F->iSepSize+1];
+				F->SuccParts = new list<Hyperedge *>;
+				F->SuccSeps = new list<Hyperedge **>;
+				F->FailParts = new list<Hyperedge *>;
+				if((F->Separator == NULL) || (F->SuccParts == NULL) || (F->SuccSeps == NULL) || (F->FailParts == NULL))
+					writeErrorMsg("Error assigning memory.", "DetKDecomp::step");
+
+				// Store separating hyperedges in the separator array
+				for(i=0; i < F->iNbrSelCov; i++)
+					F->Separator[i] = F->BoundEdges[F->CovSepSet[i]];
+				if(F->bAddEdge)
+					F->Separator[i++] = F->AddEdges[F->iAddEdge];
+				F->Separator[i] = NULL;
+
+				MySeps.push_back(F->Separator);
+				MySuccSepParts.push_back(F->SuccParts);
+				MySuccSepChoices.push_back(F->SuccSeps);
+				MyFailSepParts.push_back(F->FailParts);
+				accountMemo((long long)(F->iSepSize+1)*sizeof(Hyperedge *) + 3*sizeof(list<Hyperedge *>) + 4*MEM_LIST_ENTRY(void *));
+			}
+
+			// Separate hyperedges into partitions with corresponding connector nodes
+			lTraceStart = F->bTraced ? MyTrace->now() : 0;
+			F->iNbrOfParts = separate(F->HEdges, &F->Partitions, &F->ChildConnectors);
+			if(F->bTraced)
+				MyTrace->writeSpan("separate", lTraceStart);
+
+			// Create auxiliary array
+			F->bCutParts = new bool[F->iNbrOfParts];
+			F->CutSeps = new Hyperedge**[F->iNbrOfParts];
+			if((F->bCutParts == NULL) || (F->CutSeps == NULL))
+				writeErrorMsg("Error assigning memory.", "DetKDecomp::step");
+			F->lPartBytes = lMyPartBytes + (long long)F->iNbrOfParts*(sizeof(bool)+sizeof(Hyperedge **));
+			MemoryAccount::add(MEM_SEARCH, F->lPartBytes);
+
+			// Check partitions for decomposibility and undecomposibility
+			bFailSep = false;
+			for(i=0; i < F->iNbrOfParts; i++) {
+				for(iPartSize=0; F->Partitions[i][iPartSize] != NULL; iPartSize++);
+				if(iPartSize >= F->iNbrOfEdges)
+					writeErrorMsg("Monotonicity violated.", "DetKDecomp::step");
+
+				// Check for undecomposability
+				if(containsLabel(F->FailParts, F->Partitions[i][0]->getLabel())) {
+					if(MyProfile != NULL)
+						++MyProfile->getLevel(F->iRecLevel)->lFailHits;
+					bFailSep = true;
+					break;
+				}
+
+				// Check for decomposibility
+				if(containsLabel(F->SuccParts, F->Partitions[i][0]->getLabel())) {
+					if(MyProfile != NULL)
+						++MyProfile->getLevel(F->iRecLevel)->lSuccHits;
+					F->bCutParts[i] = true;
+					// Remember the separator needed to rebuild the pruned subtree
+					getSuccSep(F->SuccParts, F->SuccSeps, F->Partitions[i][0]->getLabel(), &F->CutSeps[i]);
+				}
+				else
+					F->bCutParts[i] = false;
+			}
+
+			if(!bFailSep) {
+				// Decompose partitions into hypertrees
+				F->Subtrees.clear();
+				F->iPart = 0;
+				F->iState = DS_PART;
+			}
+			else {
+				// Delete partitions and connectors
+				for(i=0; i < F->iNbrOfParts; i++) {
+					delete [] F->Partitions[i];
+					delete [] F->ChildConnectors[i];
+				}
+				delete [] F->Partitions;
+				delete [] F->ChildConnectors;
+				delete [] F->bCutParts;
+				delete [] F->CutSeps;
+				releaseFrame(F, true);
+				F->iState = DS_NEXT_ADD;
+			}
+			return false;
+
+		case DS_PART:
+			if(F->iPart >= F->iNbrOfParts) {
+				F->iState = DS_PARTS_DONE;
+				return false;
+			}
+
+			i = F->iPart;
+			if(F->bCutParts[i]) {
+				// Prune subtree
+				F->HTree = getHTNode(F->Partitions[i], F->ChildConnectors[i], NULL);
+				F->HTree->setCut();
+				F->HTree->setLabel(F->iRecLevel+1);
+				F->HTree->setCutSeparator(F->CutSeps[i]);
+				++lMyNbrOfCutParts;
+
+				// Continue with the next partition
+				delete [] F->Partitions[i];
+				delete [] F->ChildConnectors[i];
+				F->Subtrees.push_back(F->HTree);
+				++F->iPart;
+				return false;
+			}
+
+			// Stop resuming if the partition decomposed at the time of the checkpoint is not reached
+			if((iMyResumePos == (int)MyStack.size()) && (iMyResumePos < (int)MyResume.size()) && (MyResume[iMyResumePos-1].iPart != i))
+				iMyResumePos = (int)MyResume.size();
+
+			// Decompose component recursively
+			F->iState = DS_CHILD;
+			pushFrame(F->Partitions[i], F->ChildConnectors[i], F->iRecLevel+1);
+			return false;
+
+		case DS_CHILD:
+			// Store the result of the recursive decomposition
+			i = F->iPart;
+			F->HTree = MyResult;
+			if(F->HTree == NULL) {
+				F->FailParts->push_back(F->Partitions[i][0]);
+				accountMemo(MEM_LIST_ENTRY(Hyperedge *));
+			}
+			else {
+				F->SuccParts->push_back(F->Partitions[i][0]);
+				F->SuccSeps->push_back(MyLastSep);
+				accountMemo(MEM_LIST_ENTRY(Hyperedge *) + MEM_LIST_ENTRY(Hyperedge **));
+			}
+
+			delete [] F->Partitions[i];
+			delete [] F->ChildConnectors[i];
+
+			if(F->HTree != NULL) {
+				F->Subtrees.push_back(F->HTree);
+				++F->iPart;
+				F->iState = DS_PART;
+			}
+			else
+				F->iState = DS_PARTS_DONE;
+			return false;
+
+		case DS_PARTS_DONE:
+			// Delete remaining partitions and connectors
+			for(i=F->iPart+1; i < F->iNbrOfParts; i++) {
+				delete [] F->Partitions[i];
+				delete [] F->ChildConnectors[i];
+			}
+			delete [] F->Partitions;
+			delete [] F->ChildConnectors;
+			delete [] F->bCutParts;
+			delete [] F->CutSeps;
+			releaseFrame(F, true);
+
+			if(F->HTree == NULL) {
+				// Delete previously created subtrees
+				for(TreeIter=F->Subtrees.begin(); TreeIter != F->Subtrees.end(); TreeIter++)
+					delete *TreeIter;
+			}
+			else {
+				// Create a new hypertree node
+				for(i=0; i < F->iNbrSelCov; i++) {
+					j = F->CovSepSet[i];
+					F->bInComp[j] ? F->BoundEdges[j]->setLabel(-1) : F->BoundEdges[j]->setLabel(0);
+				}
+				if(F->bAddEdge)
+					F->AddEdges[F->iAddEdge]->setLabel(-1);
+				F->HTree = getHTNode(F->Separator, F->Connector, &F->Subtrees);
+			}
+			F->iState = DS_NEXT_ADD;
+			return false;
+
+		case DS_NEXT_ADD:
+			// Stop resuming if the separator restored from the checkpoint is given up
+			if((int)MyStack.size() <= iMyResumePos)
+				iMyResumePos = (int)MyResume.size();
+
+			if(F->bAddEdge && (F->HTree == NULL) && (++F->iAddEdge < F->iAddSize))
+				F->iState = DS_SEPARATE;
+			else
+				F->iState = DS_NEXT_COVER;
+			return false;
+
+		case DS_NEXT_COVER:
+			if((F->HTree == NULL) && ((F->iNbrSelCov = setNextSubset(F->Connector, F->BoundEdges, F->CovSepSet, F->bInComp, F->CovWeights, F->iBoundSize)) > 0)) {
+				if(MyProfile != NULL)
+					++MyProfile->getLevel(F->iRecLevel)->lCovers;
+				F->iState = DS_COVER;
+			}
+			else
+				F->iState = DS_FINISH;
+			return false;
+
+		case DS_FINISH:
+			delete [] F->InnerEdges;
+			delete [] F->BoundEdges;
+			delete [] F->AddEdges;
+			delete [] F->CovWeights;
+			delete [] F->bInComp;
+			delete [] F->CovSepSet;
+
+			if(F->HTree != NULL)
+				MyLastSep = F->Separator;
+			else if(MyProfile != NULL)
+				++MyProfile->getLevel(F->iRecLevel)->lBacktracks;
+			break;
+	}
+
+	// The decomp call is finished; pass its result to the calling frame
+	if(F->bTraced)
+		MyTrace->endDecomp((F->HTree != NULL) ? "found" : "failed");
+	MyResult = F->HTree;
+	MyStack.pop_back();
+	releaseFrame(F, false);
+	delete F;
+
+	return (int)MyStack.size() <= iBaseDepth;
+}
+
+
+/*
+***Description***
+The method removes all decomp calls from the search stack and frees their memory. It is
+assumed that the active decomp call is about to examine a new selection of covering 
+hyperedges (i.e., it is in state DS_COVER or DS_SEPARATE) and that all other calls are
+waiting for the result of a recursive call.
+*/
+
+void DetKDecomp::clearStack()
+{
+	int i;
+	DecompFrame *F;
+	list<Hypertree *>::iterator TreeIter;
+
+	while(!MyStack.empty()) {
+		F = MyStack.back();
+
+		if(F->iState == DS_CHILD) {
+			// Delete the partitions not processed yet and the subtrees built so far
+			for(i=F->iPart; i < F->iNbrOfParts; i++) {
+				delete [] F->Partitions[i];
+				delete [] F->ChildConnectors[i];
+			}
+			delete [] F->Partitions;
+			delete [] F->ChildConnectors;
+			delete [] F->bCutParts;
+			delete [] F->CutSeps;
+			for(TreeIter=F->Subtrees.begin(); TreeIter != F->Subtrees.end(); TreeIter++)
+				delete *TreeIter;
+		}
+
+		if(F->iState != DS_ENTER) {
+			delete [] F->InnerEdges;
+			delete [] F->BoundEdges;
+			delete [] F->AddEdges;
+			delete [] F->CovWeights;
+			delete [] F->bInComp;
+			delete [] F->CovSepSet;
+		}
+
+		if(F->bTraced)
+			MyTrace->endDecomp("stopped");
+		MyStack.pop_back();
+		releaseFrame(F, false);
+		delete F;
+	}
+}
+
+
+/*
+***Description***
+The method continues a decomp call with the next frame restored from a checkpoint, i.e., the 
+selection of covering hyperedges and the additional hyperedge are replaced by the separator 
+that was examined at the time of the checkpoint. It is assumed that the initial selection of
+the frame has already been determined such that the covering hyperedges are sorted.
+
+INPUT:	Frame: Actual decomp call
+*/
+
+void DetKDecomp::restoreFrame(DecompFrame *Frame)
+{
+	int i;
+	ResumeFrame *Saved = &MyResume[iMyResumePos++];
+
+	if((Frame->iNbrSelCov < 0) || (Saved->iAddEdge >= Frame->iAddSize))
+		writeErrorMsg("Checkpoint does not match the input.", "DetKDecomp::restoreFrame");
+
+	for(i=0; i < Saved->iNbrSelCov; i++) {
+		if(Saved->CovSepSet[i] >= Frame->iBoundSize)
+			writeErrorMsg("Checkpoint does not match the input.", "DetKDecomp::restoreFrame");
+		Frame->CovSepSet[i] = Saved->CovSepSet[i];
+	}
+	Frame->CovSepSet[i] = -1;
+
+	Frame->iNbrSelCov = Saved->iNbrSelCov;
+	Frame->iAddEdge = Saved->iAddEdge;
+	Frame->bResume = true;
+}
+
+
 /*
 ***Description***
 The method decomposes the hyperedges in a subhypergraph as described in Gottlob and 
-Samer: A Backtracking-Based Algorithm for Computing Hypertree-Decompositions.
+Samer: A Backtracking-Based Algorithm for Computing Hypertree-Decompositions. The
+recursion is carried out on the explicit search stack MyStack (see step()).
 
 INPUT:	HEdges: Hyperedges in the subgraph
 		Connector: Connector nodes that must be covered
@@ -727,232 +1423,171 @@ OUTPUT: return: Hypertree decomposition of HEdges
 
 Hypertree *DetKDecomp::decomp(Hyperedge **HEdges, Node **Connector, int iRecLevel)
 {
-	int *CovSepSet, *CovWeights, iBoundSize, iInnerSize, iNbrSelCov, iAddSize, iCompEnd, i, j;
-	int iNbrOfEdges, iAddEdge, iSepSize, iNbrOfNodes, iNbrOfParts, iPartSize;
-	bool bFailSep, bAddEdge, bReusedSep, *bInComp, *bCutParts;
-	Hyperedge **InnerEdges, **BoundEdges, **Separator, ***Partitions, **AddEdges, *Edge;
-	Hypertree *HTree = NULL;
+	int iBaseDepth = (int)MyStack.size();
+
+	pushFrame(HEdges, Connector, iRecLevel);
+	while(!step(iBaseDepth));
+
+	return MyResult;
+}
+
+
+/*
+***Description***
+The method rebuilds the hypertree decomposition of a component that is known to be
+decomposable. Instead of searching for separators, the separator chosen during the search
+is applied and the resulting partitions are rebuilt from the separators stored together
+with the decomposable partitions of this separator.
+
+INPUT:	HEdges: Hyperedges in the subgraph
+		Connector: Connector nodes that must be covered
+		Separator: Separator chosen for HEdges; NULL if HEdges was decomposed without separator
+		iRecLevel: Recursion level
+OUTPUT: return: Hypertree decomposition of HEdges
+*/
+
+Hypertree *DetKDecomp::rebuild(Hyperedge **HEdges, Node **Connector, Hyperedge **Separator, int iRecLevel)
+{
+	int iSepSize, iNbrOfParts, iNbrOfNodes, i, j;
+	bool *bInComp;
+	Hyperedge **StoredSep, ***Partitions, ***ChildSeps;
+	Hypertree *HTree;
 	Node ***ChildConnectors;
 	list<Hypertree *> Subtrees;
-	list<Hypertree *>::iterator TreeIter;
 	list<Hyperedge *> *SuccParts, *FailParts;
+	list<Hyperedge **> *SuccSeps;
 
-	for(iNbrOfEdges=0; HEdges[iNbrOfEdges] != NULL; iNbrOfEdges++);
+	// Trivial components are decomposed without search
+	if(Separator == NULL)
+		return decomp(HEdges, Connector, iRecLevel);
 
-	// Stop if the hypergraph can be decomposed into two hypertree-nodes
-	if((Connector[0] == NULL) && (iNbrOfEdges > 1) && ((int)ceil(iNbrOfEdges/2.0) <= iMyK)) {
-		for(i=0; i < iNbrOfEdges; i++)
-			HEdges[i]->setLabel(-1);
-		i = iNbrOfEdges / 2;
-		HTree = getHTNode(&HEdges[i], NULL, NULL);
-		HEdges[i] = NULL;
-		HTree->insChild(getHTNode(HEdges, NULL, NULL));
-		return HTree;
-	}
+	// Remember which separating hyperedges belong to the component
+	for(iSepSize=0; Separator[iSepSize] != NULL; iSepSize++);
+	bInComp = new bool[iSepSize];
+	if(bInComp == NULL)
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::rebuild");
+	MyHGraph->resetEdgeLabels();
+	for(i=0; HEdges[i] != NULL; i++)
+		HEdges[i]->setLabel(1);
+	for(i=0; i < iSepSize; i++)
+		bInComp[i] = Separator[i]->getLabel() == 1;
 
-	// Stop if the hypergraph can be decomposed into a single hypertree-node
-	if(iNbrOfEdges <= iMyK) {
-		for(i=0; i < iNbrOfEdges; i++)
-			HEdges[i]->setLabel(-1);
-		return getHTNode(HEdges, Connector, NULL);
+	// Set labels of separating nodes and hyperedges to -1
+	MyHGraph->resetEdgeLabels();
+	MyHGraph->resetNodeLabels();
+	for(i=0; i < iSepSize; i++) {
+		Separator[i]->setLabel(-1);
+		iNbrOfNodes = Separator[i]->getNbrOfNodes();
+		for(j=0; j < iNbrOfNodes; j++)
+			Separator[i]->getNode(j)->setLabel(-1);
 	}
 
-	// Divide hyperedges into inner hyperedges and hyperedges containing some connecting nodes
-	iCompEnd = divideCompEdges(HEdges, Connector, &InnerEdges, &BoundEdges);
-
-	// Count the number of inner and boundary hyperedges
-	for(iInnerSize=0; InnerEdges[iInnerSize] != NULL; iInnerSize++);
-	for(iBoundSize=0; BoundEdges[iBoundSize] != NULL; iBoundSize++);
-
-	// Create auxiliary arrays
-	CovSepSet = new int[iMyK+1];
-	bInComp = new bool[iBoundSize];
-	CovWeights = new int[iBoundSize];
-	AddEdges = new Hyperedge*[iInnerSize+iCompEnd+1];
-	if((CovSepSet == NULL) || (bInComp == NULL) || (CovWeights == NULL) || (AddEdges == NULL))
-		writeErrorMsg("Error assigning memory.", "DetKDecomp::decomp");
-
-	// Initialize bInComp array
-	iAddSize = 0;
-	for(i=0; i < iBoundSize; i++)
-		i < iCompEnd ? bInComp[i] = true : bInComp[i] = false;
-
-	// Select initial hyperedges to cover the connecting nodes
-	iNbrSelCov = setInitSubset(Connector, BoundEdges, CovSepSet, bInComp, CovWeights, iBoundSize);
-
-	// Initialize AddEdges array
-	iAddSize = 0;
-	for(i=0; i < iBoundSize; i++)
-		if(bInComp[i])
-			AddEdges[iAddSize++] = BoundEdges[i];
-	for(i=0; i < iInnerSize; i++)
-		AddEdges[iAddSize++] = InnerEdges[i];
-	AddEdges[iAddSize] = NULL;
-	if(iAddSize <= 0)
-		writeErrorMsg("Illegal number of hyperedges.", "DetKDecomp::decomp");
-
-	if(iNbrSelCov >= 0)
-		do {
-			// Check whether a covering hyperedge within the component was selected
-			bAddEdge = true;
-			for(i=0; i < iNbrSelCov; i++)
-				if(bInComp[CovSepSet[i]]) {
-					bAddEdge = false;
-					break;
-				}
-
-			// Stop if no inner hyperedge can be in the separator
-			if(!bAddEdge || (iMyK-iNbrSelCov > 0)) {
+	if(!getSepParts(iSepSize, &StoredSep, &SuccParts, &SuccSeps, &FailParts))
+		writeErrorMsg("Illegal decomposition pruning.", "DetKDecomp::rebuild");
+
+	// Separate hyperedges into partitions and look up the separators chosen for them
+	iNbrOfParts = separate(HEdges, &Partitions, &ChildConnectors);
+	ChildSeps = new Hyperedge**[iNbrOfParts];
+	if(ChildSeps == NULL)
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::rebuild");
+	for(i=0; i < iNbrOfParts; i++)
+		if(!getSuccSep(SuccParts, SuccSeps, Partitions[i][0]->getLabel(), &ChildSeps[i]))
+			writeErrorMsg("Illegal decomposition pruning.", "DetKDecomp::rebuild");
+
+	// Rebuild the partitions
+	for(i=0; i < iNbrOfParts; i++) {
+		Subtrees.push_back(rebuild(Partitions[i], ChildConnectors[i], ChildSeps[i], iRecLevel+1));
+		delete [] Partitions[i];
+		delete [] ChildConnectors[i];
+	}
+	delete [] Partitions;
+	delete [] ChildConnectors;
+	delete [] ChildSeps;
+
+	// Create a new hypertree node
+	for(i=0; i < iSepSize; i++)
+		bInComp[i] ? Separator[i]->setLabel(-1) : Separator[i]->setLabel(0);
+	HTree = getHTNode(Separator, Connector, &Subtrees);
+	delete [] bInComp;
 
-				iAddEdge = 0;
-				bAddEdge ? iSepSize = iNbrSelCov+1 : iSepSize = iNbrSelCov;
+	return HTree;
+}
 
-				do {
-					// Output the search progress
-					// cout << "(" << iRecLevel << ")"; cout.flush();
 
-					// Set labels of separating nodes and hyperedges to -1
-					MyHGraph->resetEdgeLabels();
-					MyHGraph->resetNodeLabels();
-					for(i=0; i < iNbrSelCov; i++) {
-						Edge = BoundEdges[CovSepSet[i]];
-						Edge->setLabel(-1);
-						iNbrOfNodes = Edge->getNbrOfNodes();
-						for(j=0; j < iNbrOfNodes; j++)
-							Edge->getNode(j)->setLabel(-1);
-					}
-					if(bAddEdge) {
-						Edge = AddEdges[iAddEdge];
-						Edge->setLabel(-1);
-						iNbrOfNodes = Edge->getNbrOfNodes();
-						for(j=0; j < iNbrOfNodes; j++)
-							Edge->getNode(j)->setLabel(-1);
-					}
+/*
+***Description***
+The method rebuilds the hypertree decomposition of a component from the separators read from
+the replay file. The separators are used in the order in which collectSeps recorded them; 
+components that are decomposed without separator by decomp (i.e., with at most k hyperedges or
+the whole hypergraph with at most 2k hyperedges) do not use a separator.
 
-					// Check if selected hyperedges were already used before as separator
-					bReusedSep = getSepParts(iSepSize, &Separator, &SuccParts, &FailParts);
-					if(!bReusedSep) {
-						// Create a separator array and lists for decomposable and undecomposable parts
-						Separator = new Hyperedge*[iSepSize+1];
-						SuccParts = new list<Hyperedge *>;
-						FailParts = new list<Hyperedge *>;
-						if((Separator == NULL) || (SuccParts == NULL) || (FailParts == NULL))
-							writeErrorMsg("Error assigning memory.", "DetKDecomp::decomp");
-
-						// Store separating hyperedges in the separator array
-						for(i=0; i < iNbrSelCov; i++)
-							Separator[i] = BoundEdges[CovSepSet[i]];
-						if(bAddEdge)
-							Separator[i++] = AddEdges[iAddEdge];
-						Separator[i] = NULL;
-
-						MySeps.push_back(Separator);
-						MySuccSepParts.push_back(SuccParts);
-						MyFailSepParts.push_back(FailParts);
-					}
+INPUT:	HEdges: Hyperedges in the subgraph
+		Connector: Connector nodes that must be covered
+		iRecLevel: Recursion level
+OUTPUT: return: Hypertree decomposition of HEdges
+*/
 
-					// Separate hyperedges into partitions with corresponding connector nodes
-					iNbrOfParts = separate(HEdges, &Partitions, &ChildConnectors);
-
-					// Create auxiliary array
-					bCutParts = new bool[iNbrOfParts];
-					if(bCutParts == NULL)
-						writeErrorMsg("Error assigning memory.", "DetKDecomp::decomp");
-
-					// Check partitions for decomposibility and undecomposibility
-					bFailSep = false;
-					for(i=0; i < iNbrOfParts; i++) {
-						for(iPartSize=0; Partitions[i][iPartSize] != NULL; iPartSize++);
-						if(iPartSize >= iNbrOfEdges)
-							writeErrorMsg("Monotonicity violated.", "DetKDecomp::decomp");
-
-						// Check for undecomposability
-						if(containsLabel(FailParts, Partitions[i][0]->getLabel())) {
-							bFailSep = true;
-							break;
-						}
-
-						// Check for decomposibility
-						if(containsLabel(SuccParts, Partitions[i][0]->getLabel()))
-							bCutParts[i] = true;
-						else
-							bCutParts[i] = false;
-					}
+Hypertree *DetKDecomp::replay(Hyperedge **HEdges, Node **Connector, int iRecLevel)
+{
+	int iNbrOfEdges, iSepSize, iNbrOfParts, iNbrOfNodes, i, j;
+	bool *bInComp, bValid;
+	Hyperedge **Separator, ***Partitions;
+	Hypertree *HTree;
+	Node ***ChildConnectors;
+	list<Hypertree *> Subtrees;
 
-					if(!bFailSep) {
-						// Decompose partitions into hypertrees
-						Subtrees.clear();
-						for(i=0; i < iNbrOfParts; i++) {
-							if(bCutParts[i]) {
-								// Prune subtree
-								HTree = getHTNode(Partitions[i], ChildConnectors[i], NULL);
-								HTree->setCut();
-								HTree->setLabel(iRecLevel+1);
-							}
-							else {
-								// Decompose component recursively
-								HTree = decomp(Partitions[i], ChildConnectors[i], iRecLevel+1);
-								if(HTree == NULL)
-									FailParts->push_back(Partitions[i][0]);
-								else
-									SuccParts->push_back(Partitions[i][0]);
-							}
-			
-							delete [] Partitions[i];
-							delete [] ChildConnectors[i];
-		
-							if(HTree != NULL)
-								Subtrees.push_back(HTree);
-							else break;
-						}
-
-						// Delete remaining partitions and connectors
-						for(i++; i < iNbrOfParts; i++) {
-							delete [] Partitions[i];
-							delete [] ChildConnectors[i];
-						}
-						delete [] Partitions;
-						delete [] ChildConnectors;
-						delete [] bCutParts;
-
-						if(HTree == NULL) {
-							// Delete previously created subtrees
-							for(TreeIter=Subtrees.begin(); TreeIter != Subtrees.end(); TreeIter++)
-								delete *TreeIter;
-						}
-						else {
-							// Create a new hypertree node
-							for(i=0; i < iNbrSelCov; i++) {
-								j = CovSepSet[i];
-								bInComp[j] ? BoundEdges[j]->setLabel(-1) : BoundEdges[j]->setLabel(0);
-							}
-							if(bAddEdge)
-								AddEdges[iAddEdge]->setLabel(-1);
-							HTree = getHTNode(Separator, Connector, &Subtrees);
-						}
-					}
-					else {
-						// Delete partitions and connectors
-						for(i=0; i < iNbrOfParts; i++) {
-							delete [] Partitions[i];
-							delete [] ChildConnectors[i];
-						}
-						delete [] Partitions;
-						delete [] ChildConnectors;
-						delete [] bCutParts;
-					}
-					
-				} while(bAddEdge && (HTree == NULL) && (++iAddEdge < iAddSize));
-			}
+	// Trivial components are decomposed without search
+	for(iNbrOfEdges=0; HEdges[iNbrOfEdges] != NULL; iNbrOfEdges++);
+	if((iNbrOfEdges <= iMyK) || ((Connector[0] == NULL) && (iNbrOfEdges > 1) && ((int)ceil(iNbrOfEdges/2.0) <= iMyK)))
+		return decomp(HEdges, Connector, iRecLevel);
+
+	if(iMyReplayPos >= (int)MyReplaySeps.size())
+		writeErrorMsg("Record file does not match the input.", "DetKDecomp::replay");
+	Separator = MyReplaySeps[iMyReplayPos++];
+
+	// Remember which separating hyperedges belong to the component; at least one of them must
+	// belong to it such that the partitions become smaller
+	for(iSepSize=0; Separator[iSepSize] != NULL; iSepSize++);
+	bInComp = new bool[iSepSize];
+	if(bInComp == NULL)
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::replay");
+	MyHGraph->resetEdgeLabels();
+	for(i=0; HEdges[i] != NULL; i++)
+		HEdges[i]->setLabel(1);
+	for(bValid=false, i=0; i < iSepSize; i++)
+		if((bInComp[i] = Separator[i]->getLabel() == 1))
+			bValid = true;
 
-		} while((HTree == NULL) && ((iNbrSelCov = setNextSubset(Connector, BoundEdges, CovSepSet, bInComp, CovWeights, iBoundSize)) > 0));
+	// Set labels of separating nodes and hyperedges to -1 and check that the connector is covered
+	MyHGraph->resetEdgeLabels();
+	MyHGraph->resetNodeLabels();
+	for(i=0; i < iSepSize; i++) {
+		Separator[i]->setLabel(-1);
+		iNbrOfNodes = Separator[i]->getNbrOfNodes();
+		for(j=0; j < iNbrOfNodes; j++)
+			Separator[i]->getNode(j)->setLabel(-1);
+	}
+	for(i=0; Connector[i] != NULL; i++)
+		if(Connector[i]->getLabel() != -1)
+			bValid = false;
+	if(!bValid || (iSepSize > iMyK))
+		writeErrorMsg("Record file does not match the input.", "DetKDecomp::replay");
+
+	// Separate hyperedges into partitions and rebuild them
+	iNbrOfParts = separate(HEdges, &Partitions, &ChildConnectors);
+	for(i=0; i < iNbrOfParts; i++) {
+		Subtrees.push_back(replay(Partitions[i], ChildConnectors[i], iRecLevel+1));
+		delete [] Partitions[i];
+		delete [] ChildConnectors[i];
+	}
+	delete [] Partitions;
+	delete [] ChildConnectors;
 
-	delete [] InnerEdges;
-	delete [] BoundEdges;
-	delete [] AddEdges;
-	delete [] CovWeights;
+	// Create a new hypertree node
+	for(i=0; i < iSepSize; i++)
+		bInComp[i] ? Separator[i]->setLabel(-1) : Separator[i]->setLabel(0);
+	HTree = getHTNode(Separator, Connector, &Subtrees);
 	delete [] bInComp;
-	delete [] CovSepSet;
 
 	return HTree;
 }
@@ -961,28 +1596,27 @@ Hypertree *DetKDecomp::decomp(Hyperedge **HEdges, Node **Connector, int iRecLeve
 /*
 ***Description***
 The method expands pruned hypertree nodes, i.e., subgraphs which were not decomposed but are
-known to be decomposable are decomposed.
+known to be decomposable are rebuilt from the separators stored during the search. The pruned
+nodes are processed as a work list that is filled by a single traversal of the hypertree.
 
-INPUT:	HTree: Hypertree that has to be expanded
-OUTPUT: HTree: Expanded hypertree
+INPUT:	CutNodes: Pruned hypertree nodes that have to be expanded
+OUTPUT: CutNodes: Empty list; all pruned nodes are replaced by the corresponding subtrees
 */
 
-void DetKDecomp::expandHTree(Hypertree *HTree)
+void DetKDecomp::expandHTree(list<Hypertree *> *CutNodes)
 {
 	int iNbrOfEdges, i;
 	Hypertree *CutNode, *Subtree;
-	Hyperedge **HEdges, **ParentSep;
+	Hyperedge **HEdges, **Separator;
 	Node **Connector;
 	set<Hyperedge *> *Lambda;
 	set<Node *> *Chi;
 	set<Hyperedge *>::iterator SetIter1;
 	set<Node *>::iterator SetIter2;
-	
-	ParentSep = new Hyperedge*[iMyK+1];
-	if(ParentSep == NULL)
-		writeErrorMsg("Error assigning memory.", "DetKDecomp::expandHTree");
 
-	while((CutNode = HTree->getCutNode()) != NULL) {
+	while(!CutNodes->empty()) {
+		CutNode = CutNodes->front();
+		CutNodes->pop_front();
 
 		// Store subgraph in an array
 		Lambda = CutNode->getLambda();
@@ -1002,16 +1636,9 @@ void DetKDecomp::expandHTree(Hypertree *HTree)
 			Connector[i] = *SetIter2;
 		Connector[i] = NULL;
 
-		// Reconstruct parent separator
-		Lambda = CutNode->getParent()->getLambda();
-		for(i=0, SetIter1 = Lambda->begin(); SetIter1 != Lambda->end(); i++, SetIter1++)
-			ParentSep[i] = *SetIter1;
-		ParentSep[i] = NULL;
-
-		// Decompose subgraph
-		Subtree = decomp(HEdges, Connector, CutNode->getLabel());
-		if(Subtree == NULL)
-			writeErrorMsg("Illegal decomposition pruning.", "H_DetKDecomp::expandHTree");
+		// Rebuild the decomposition of the subgraph
+		Separator = CutNode->getCutSeparator();
+		Subtree = rebuild(HEdges, Connector, Separator, CutNode->getLabel());
 
 		// Replace the pruned node by the corresponding subtree
 		CutNode->getParent()->insChild(Subtree);
@@ -1021,8 +1648,629 @@ void DetKDecomp::expandHTree(Hypertree *HTree)
 		delete [] HEdges;
 		delete [] Connector;
 	}
+}
+
+
+/*
+***Description***
+The method writes the actual state of the search to the checkpoint file. The state consists
+of the initial order of the hyperedges, the separators examined so far together with their 
+decomposable and undecomposable partitions, and the selection of covering hyperedges of each 
+decomp call on the search stack. Hyperedges are identified by their IDs. The file is written
+to a temporary file first, which replaces the previous checkpoint afterwards. It is assumed 
+that the active decomp call is about to examine a new separator or a new selection of 
+covering hyperedges.
+
+INPUT:	HEdges: Initial order of the hyperedges
+*/
+
+void DetKDecomp::writeCheckpoint(Hyperedge **HEdges)
+{
+	int iNbrOfSeps, i, j;
+	char *cTmpFile;
+	vector<int> Data;
+	map<Hyperedge **, int> SepIndex;
+	list<Hyperedge **>::iterator SepIter, SuccSepIter;
+	list<list<Hyperedge *> *>::iterator SuccPartIter, FailPartIter;
+	list<list<Hyperedge **> *>::iterator SuccSepsIter;
+	list<Hyperedge *>::iterator EdgeIter;
+	DecompFrame *Frame;
+	ofstream Out;
+
+	// Write header
+	Data.push_back(CHECKPOINT_MAGIC);
+	Data.push_back(CHECKPOINT_VERSION);
+	Data.push_back(iMyK);
+	Data.push_back(MyHGraph->getNbrOfEdges());
+	Data.push_back(MyHGraph->getNbrOfNodes());
+
+	// Write initial order of the hyperedges
+	for(i=0; HEdges[i] != NULL; i++)
+		Data.push_back(HEdges[i]->getID());
+
+	// Write separators
+	Data.push_back((int)MySeps.size());
+	for(iNbrOfSeps=0, SepIter=MySeps.begin(); SepIter != MySeps.end(); iNbrOfSeps++, SepIter++) {
+		SepIndex[*SepIter] = iNbrOfSeps;
+		for(j=0; (*SepIter)[j] != NULL; j++);
+		Data.push_back(j);
+		for(j=0; (*SepIter)[j] != NULL; j++)
+			Data.push_back((*SepIter)[j]->getID());
+	}
+
+	// Write decomposable and undecomposable partitions of each separator
+	SuccPartIter = MySuccSepParts.begin();
+	SuccSepsIter = MySuccSepChoices.begin();
+	for(FailPartIter=MyFailSepParts.begin(); FailPartIter != MyFailSepParts.end(); FailPartIter++) {
+		Data.push_back((int)(*SuccPartIter)->size());
+		for(EdgeIter=(*SuccPartIter)->begin(), SuccSepIter=(*SuccSepsIter)->begin(); EdgeIter != (*SuccPartIter)->end(); EdgeIter++, SuccSepIter++) {
+			Data.push_back((*EdgeIter)->getID());
+			Data.push_back(*SuccSepIter == NULL ? -1 : SepIndex[*SuccSepIter]);
+		}
+		Data.push_back((int)(*FailPartIter)->size());
+		for(EdgeIter=(*FailPartIter)->begin(); EdgeIter != (*FailPartIter)->end(); EdgeIter++)
+			Data.push_back((*EdgeIter)->getID());
+		++SuccPartIter;
+		++SuccSepsIter;
+	}
+
+	// Write the selections of the decomp calls on the search stack
+	Data.push_back((int)MyStack.size());
+	for(i=0; i < (int)MyStack.size(); i++) {
+		Frame = MyStack[i];
+		Data.push_back(Frame->iNbrSelCov);
+		for(j=0; j < Frame->iNbrSelCov; j++)
+			Data.push_back(Frame->CovSepSet[j]);
+		Data.push_back(((Frame->iState == DS_COVER) || !Frame->bAddEdge) ? 0 : Frame->iAddEdge);
+		Data.push_back(Frame->iState == DS_CHILD ? Frame->iPart : -1);
+	}
+
+	// Write data to a temporary file and replace the previous checkpoint
+	cTmpFile = new char[strlen(cMyCheckpointFile)+5];
+	if(cTmpFile == NULL)
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::writeCheckpoint");
+	strcpy(cTmpFile, cMyCheckpointFile);
+	strcat(cTmpFile, ".tmp");
+
+	Out.open(cTmpFile, ios::out | ios::binary | ios::trunc);
+	if(Out.is_open())
+		Out.write((char *)&Data[0], Data.size()*sizeof(int));
+	if(!Out.is_open() || !Out.good())
+		writeErrorMsg("Error writing checkpoint file.", "DetKDecomp::writeCheckpoint", false);
+	else {
+		Out.close();
+		if(rename(cTmpFile, cMyCheckpointFile) != 0)
+			writeErrorMsg("Error writing checkpoint file.", "DetKDecomp::writeCheckpoint", false);
+	}
+
+	delete [] cTmpFile;
+}
+
+
+/*
+***Description***
+The method reads the state of the search from the resume file written by writeCheckpoint.
+The separators and their partitions are stored in the separator tables, the selections of 
+the decomp calls are stored in MyResume and are continued by restoreFrame.
+
+OUTPUT: HEdges: Initial order of the hyperedges (terminated by NULL)
+*/
+
+void DetKDecomp::readCheckpoint(Hyperedge **HEdges)
+{
+	int iNbrOfEdges, iNbrOfValues, iPos, iNbrOfSeps, iNbrOfFrames, iSize, iSep, i, j;
+	Hyperedge **EdgeByID, **Separator;
+	vector<int> Data;
+	vector<Hyperedge **> Seps;
+	list<Hyperedge *> *SuccParts, *FailParts;
+	list<Hyperedge **> *SuccSeps;
+	ResumeFrame Frame;
+	ifstream In;
+
+	// Read the whole file
+	In.open(cMyResumeFile, ios::in | ios::binary);
+	if(!In.is_open())
+		writeErrorMsg("Error opening checkpoint file.", "DetKDecomp::readCheckpoint");
+	In.seekg(0, ios::end);
+	iNbrOfValues = (int)In.tellg() / sizeof(int);
+	In.seekg(0, ios::beg);
+	Data.resize(iNbrOfValues+1);
+	In.read((char *)&Data[0], iNbrOfValues*sizeof(int));
+	if(!In.good())
+		writeErrorMsg("Error reading checkpoint file.", "DetKDecomp::readCheckpoint");
+	In.close();
+	Data.resize(iNbrOfValues);
+
+	// Check header
+	iNbrOfEdges = MyHGraph->getNbrOfEdges();
+	if((iNbrOfValues < 5) || (Data[0] != CHECKPOINT_MAGIC) || (Data[1] != CHECKPOINT_VERSION))
+		writeErrorMsg("Invalid checkpoint file.", "DetKDecomp::readCheckpoint");
+	if((Data[2] != iMyK) || (Data[3] != iNbrOfEdges) || (Data[4] != MyHGraph->getNbrOfNodes()))
+		writeErrorMsg("Checkpoint does not match the input.", "DetKDecomp::readCheckpoint");
+	iPos = 5;
+
+	// Create a lookup table for the hyperedge IDs
+	EdgeByID = new Hyperedge*[iNbrOfEdges];
+	if(EdgeByID == NULL)
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::readCheckpoint");
+	for(i=0; i < iNbrOfEdges; i++) {
+		j = MyHGraph->getEdge(i)->getID();
+		if((j < 0) || (j >= iNbrOfEdges))
+			writeErrorMsg("Checkpoint does not match the input.", "DetKDecomp::readCheckpoint");
+		EdgeByID[j] = MyHGraph->getEdge(i);
+	}
+
+	// Read initial order of the hyperedges
+	for(i=0; i < iNbrOfEdges; i++)
+		HEdges[i] = nextCheckpointEdge(&Data, &iPos, EdgeByID, iNbrOfEdges);
+	HEdges[i] = NULL;
+
+	// Read separators
+	iNbrOfSeps = nextCheckpointValue(&Data, &iPos);
+	for(iSep=0; iSep < iNbrOfSeps; iSep++) {
+		iSize = nextCheckpointValue(&Data, &iPos);
+		if((iSize < 1) || (iSize > iMyK))
+			writeErrorMsg("Invalid checkpoint file.", "DetKDecomp::readCheckpoint");
+		Separator = new Hyperedge*[iSize+1];
+		if(Separator == NULL)
+			writeErrorMsg("Error assigning memory.", "DetKDecomp::readCheckpoint");
+		for(i=0; i < iSize; i++)
+			Separator[i] = nextCheckpointEdge(&Data, &iPos, EdgeByID, iNbrOfEdges);
+		Separator[i] = NULL;
+		MySeps.push_back(Separator);
+		Seps.push_back(Separator);
+		accountMemo((long long)(iSize+1)*sizeof(Hyperedge *) + MEM_LIST_ENTRY(Hyperedge **));
+	}
+
+	// Read decomposable and undecomposable partitions of each separator
+	for(iSep=0; iSep < iNbrOfSeps; iSep++) {
+		SuccParts = new list<Hyperedge *>;
+		SuccSeps = new list<Hyperedge **>;
+		FailParts = new list<Hyperedge *>;
+		if((SuccParts == NULL) || (SuccSeps == NULL) || (FailParts == NULL))
+			writeErrorMsg("Error assigning memory.", "DetKDecomp::readCheckpoint");
+
+		iSize = nextCheckpointValue(&Data, &iPos);
+		for(i=0; i < iSize; i++) {
+			SuccParts->push_back(nextCheckpointEdge(&Data, &iPos, EdgeByID, iNbrOfEdges));
+			j = nextCheckpointValue(&Data, &iPos);
+			if((j < -1) || (j >= iNbrOfSeps))
+				writeErrorMsg("Invalid checkpoint file.", "DetKDecomp::readCheckpoint");
+			SuccSeps->push_back(j < 0 ? NULL : Seps[j]);
+		}
+		iSize = nextCheckpointValue(&Data, &iPos);
+		for(i=0; i < iSize; i++)
+			FailParts->push_back(nextCheckpointEdge(&Data, &iPos, EdgeByID, iNbrOfEdges));
+
+		MySuccSepParts.push_back(SuccParts);
+		MySuccSepChoices.push_back(SuccSeps);
+		MyFailSepParts.push_back(FailParts);
+		accountMemo(3*sizeof(list<Hyperedge *>) + 3*MEM_LIST_ENTRY(void *) + (long long)(2*SuccParts->size() + FailParts->size())*MEM_LIST_ENTRY(Hyperedge *));
+	}
+
+	// Read the selections of the decomp calls on the search stack
+	iNbrOfFrames = nextCheckpointValue(&Data, &iPos);
+	for(i=0; i < iNbrOfFrames; i++) {
+		Frame.iNbrSelCov = nextCheckpointValue(&Data, &iPos);
+		if((Frame.iNbrSelCov < 0) || (Frame.iNbrSelCov > iMyK))
+			writeErrorMsg("Invalid checkpoint file.", "DetKDecomp::readCheckpoint");
+		Frame.CovSepSet = new int[iMyK+1];
+		if(Frame.CovSepSet == NULL)
+			writeErrorMsg("Error assigning memory.", "DetKDecomp::readCheckpoint");
+		for(j=0; j < Frame.iNbrSelCov; j++)
+			if((Frame.CovSepSet[j] = nextCheckpointValue(&Data, &iPos)) < 0)
+				writeErrorMsg("Invalid checkpoint file.", "DetKDecomp::readCheckpoint");
+		Frame.CovSepSet[j] = -1;
+		Frame.iAddEdge = nextCheckpointValue(&Data, &iPos);
+		Frame.iPart = nextCheckpointValue(&Data, &iPos);
+		if(Frame.iAddEdge < 0)
+			writeErrorMsg("Invalid checkpoint file.", "DetKDecomp::readCheckpoint");
+		MyResume.push_back(Frame);
+	}
+	if(iPos != (int)Data.size())
+		writeErrorMsg("Invalid checkpoint file.", "DetKDecomp::readCheckpoint");
+
+	delete [] EdgeByID;
+}
+
+
+/*
+***Description***
+The method collects the separators of the decomposition that rebuild would create for a
+component in preorder, i.e., the separator of the component followed by the separators of its
+partitions in the order given by separate. Components decomposed without separator are skipped.
+
+INPUT:	HEdges: Hyperedges in the subgraph
+		Separator: Separator chosen for HEdges; NULL if HEdges was decomposed without separator
+OUTPUT: Seps: Separators appended in preorder
+*/
+
+void DetKDecomp::collectSeps(Hyperedge **HEdges, Hyperedge **Separator, vector<Hyperedge **> *Seps)
+{
+	int iSepSize, iNbrOfParts, iNbrOfNodes, i, j;
+	Hyperedge **StoredSep, ***Partitions, ***ChildSeps;
+	Node ***ChildConnectors;
+	list<Hyperedge *> *SuccParts, *FailParts;
+	list<Hyperedge **> *SuccSeps;
+
+	if(Separator == NULL)
+		return;
+	Seps->push_back(Separator);
+
+	// Set labels of separating nodes and hyperedges to -1
+	MyHGraph->resetEdgeLabels();
+	MyHGraph->resetNodeLabels();
+	for(iSepSize=0; Separator[iSepSize] != NULL; iSepSize++) {
+		Separator[iSepSize]->setLabel(-1);
+		iNbrOfNodes = Separator[iSepSize]->getNbrOfNodes();
+		for(j=0; j < iNbrOfNodes; j++)
+			Separator[iSepSize]->getNode(j)->setLabel(-1);
+	}
+
+	if(!getSepParts(iSepSize, &StoredSep, &SuccParts, &SuccSeps, &FailParts))
+		writeErrorMsg("Illegal decomposition pruning.", "DetKDecomp::collectSeps");
+
+	// Separate hyperedges into partitions and look up the separators chosen for them
+	iNbrOfParts = separate(HEdges, &Partitions, &ChildConnectors);
+	ChildSeps = new Hyperedge**[iNbrOfParts];
+	if(ChildSeps == NULL)
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::collectSeps");
+	for(i=0; i < iNbrOfParts; i++)
+		if(!getSuccSep(SuccParts, SuccSeps, Partitions[i][0]->getLabel(), &ChildSeps[i]))
+			writeErrorMsg("Illegal decomposition pruning.", "DetKDecomp::collectSeps");
+
+	for(i=0; i < iNbrOfParts; i++) {
+		collectSeps(Partitions[i], ChildSeps[i], Seps);
+		delete [] Partitions[i];
+		delete [] ChildConnectors[i];
+	}
+	delete [] Partitions;
+	delete [] ChildConnectors;
+	delete [] ChildSeps;
+}
+
+
+/*
+***Description***
+The method writes the record file: a header with k and the size of the hypergraph, the initial
+order of the hyperedges, and one line per separator in the order of their use by replay. 
+Hyperedges are identified by their IDs. The file is a text file such that the records of two 
+runs can be compared line by line.
+
+INPUT:	HEdges: Initial order of the hyperedges
+		Seps: Separators in preorder
+*/
+
+void DetKDecomp::writeRecord(Hyperedge **HEdges, vector<Hyperedge **> *Seps)
+{
+	int i, j;
+	ofstream Out;
+
+	Out.open(cMyRecordFile, ios::out);
+	if(!Out.is_open()) {
+		writeErrorMsg("Error opening record file.", "DetKDecomp::writeRecord", false);
+		return;
+	}
+
+	Out << RECORD_HEADER << " " << RECORD_VERSION << endl;
+	Out << "k " << iMyK << " edges " << MyHGraph->getNbrOfEdges() << " nodes " << MyHGraph->getNbrOfNodes() << endl;
+	Out << "order";
+	for(i=0; HEdges[i] != NULL; i++)
+		Out << " " << HEdges[i]->getID();
+	Out << endl;
+	for(i=0; i < (int)Seps->size(); i++) {
+		Out << "sep";
+		for(j=0; (*Seps)[i][j] != NULL; j++)
+			Out << " " << (*Seps)[i][j]->getID();
+		Out << endl;
+	}
+	Out << "end" << endl;
+
+	Out.close();
+	if(Out.fail())
+		writeErrorMsg("Error writing record file.", "DetKDecomp::writeRecord", false);
+}
+
+
+/*
+***Description***
+The method reads the initial order of the hyperedges and the separators from the replay file
+written by writeRecord.
+
+INPUT:	HEdges: Array of size |E|+1
+OUTPUT: HEdges: Initial order of the hyperedges (terminated by NULL)
+*/
+
+void DetKDecomp::readRecord(Hyperedge **HEdges)
+{
+	int iNbrOfEdges, iVersion, iK, iEdges, iNodes, iID, i, j;
+	bool *bUsed;
+	string Word, Line;
+	Hyperedge **EdgeByID, **Separator;
+	vector<Hyperedge *> Edges;
+	ifstream In;
+	istringstream LineIn;
+
+	In.open(cMyReplayFile, ios::in);
+	if(!In.is_open())
+		writeErrorMsg("Error opening record file.", "DetKDecomp::readRecord");
+
+	// Check header
+	iNbrOfEdges = MyHGraph->getNbrOfEdges();
+	if(!(In >> Word >> iVersion) || (Word != RECORD_HEADER) || (iVersion != RECORD_VERSION))
+		writeErrorMsg("Invalid record file.", "DetKDecomp::readRecord");
+	if(!(In >> Word >> iK) || (Word != "k") || !(In >> Word >> iEdges) || (Word != "edges") || !(In >> Word >> iNodes) || (Word != "nodes"))
+		writeErrorMsg("Invalid record file.", "DetKDecomp::readRecord");
+	if((iK != iMyK) || (iEdges != iNbrOfEdges) || (iNodes != MyHGraph->getNbrOfNodes()))
+		writeErrorMsg("Record file does not match the input.", "DetKDecomp::readRecord");
+
+	// Create a lookup table for the hyperedge IDs
+	EdgeByID = new Hyperedge*[iNbrOfEdges];
+	bUsed = new bool[iNbrOfEdges];
+	if((EdgeByID == NULL) || (bUsed == NULL))
+		writeErrorMsg("Error assigning memory.", "DetKDecomp::readRecord");
+	for(i=0; i < iNbrOfEdges; i++) {
+		j = MyHGraph->getEdge(i)->getID();
+		if((j < 0) || (j >= iNbrOfEdges))
+			writeErrorMsg("Record file does not match the input.", "DetKDecomp::readRecord");
+		EdgeByID[j] = MyHGraph->getEdge(i);
+		bUsed[j] = false;
+	}
+
+	// Read initial order of the hyperedges; each hyperedge must occur exactly once
+	if(!(In >> Word) || (Word != "order"))
+		writeErrorMsg("Invalid record file.", "DetKDecomp::readRecord");
+	for(i=0; i < iNbrOfEdges; i++) {
+		if(!(In >> iID) || (iID < 0) || (iID >= iNbrOfEdges) || bUsed[iID])
+			writeErrorMsg("Invalid record file.", "DetKDecomp::readRecord");
+		bUsed[iID] = true;
+		HEdges[i] = EdgeByID[iID];
+	}
+	HEdges[i] = NULL;
+
+	// Read separators
+	while((In >> Word) && (Word == "sep")) {
+		getline(In, Line);
+		LineIn.clear();
+		LineIn.str(Line);
+		Edges.clear();
+		while(LineIn >> iID) {
+			if((iID < 0) || (iID >= iNbrOfEdges))
+				writeErrorMsg("Invalid record file.", "DetKDecomp::readRecord");
+			Edges.push_back(EdgeByID[iID]);
+		}
+		if(!LineIn.eof() || Edges.empty())
+			writeErrorMsg("Invalid record file.", "DetKDecomp::readRecord");
+
+		Separator = new Hyperedge*[Edges.size()+1];
+		if(Separator == NULL)
+			writeErrorMsg("Error assigning memory.", "DetKDecomp::readRecord");
+		for(i=0; i < (int)Edges.size(); i++)
+			Separator[i] = Edges[i];
+		Separator[i] = NULL;
+		MyReplaySeps.push_back(Separator);
+	}
+	if(Word != "end")
+		writeErrorMsg("Invalid record file.", "DetKDecomp::readRecord");
+
+	delete [] EdgeByID;
+	delete [] bUsed;
+}
+
+
+/*
+***Description***
+The method writes the state of the running search as one JSON object per line: the elapsed
+time, the depth of the search stack, the position in the enumeration of the separators of the
+whole hypergraph (on the top level, there is no connector to cover, so each hyperedge is tried
+as separator and the number of hyperedges is exact), the sizes of the separator tables, the
+numbers of decomp calls and examined separators together with the decomp calls per second since
+the last record, and the current resident set size. The record is written by the searching
+thread between two steps, so no synchronization is needed.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void DetKDecomp::writeProgress()
+{
+	long long lNow, lInterval, lSuccParts = 0, lFailParts = 0;
+	int iTopSep = 0, iTopSeps = 0;
+	DecompFrame *Top = MyStack.front();
+	chrono::steady_clock::time_point Now = chrono::steady_clock::now();
+	list<list<Hyperedge *> *>::iterator ListIter;
+	char cSeconds[32];
+
+	for(ListIter=MySuccSepParts.begin(); ListIter != MySuccSepParts.end(); ListIter++)
+		lSuccParts += (*ListIter)->size();
+	for(ListIter=MyFailSepParts.begin(); ListIter != MyFailSepParts.end(); ListIter++)
+		lFailParts += (*ListIter)->size();
+
+	// The top-level frame is enumerating separators as soon as its hyperedges are divided
+	if(Top->iState != DS_ENTER) {
+		iTopSep = Top->iAddEdge+1;
+		iTopSeps = Top->iAddSize;
+	}
+
+	lNow = chrono::duration_cast<chrono::microseconds>(Now - MyStart).count();
+	lInterval = chrono::duration_cast<chrono::microseconds>(Now - MyLastProgress).count();
+	sprintf(cSeconds, "%.3f", lNow / 1e6);
+
+	*MyProgressOut << "{\"elapsed\": " << cSeconds << ", \"k\": " << iMyK << ", \"depth\": " << MyStack.size();
+	*MyProgressOut << ", \"top_sep\": " << iTopSep << ", \"top_seps\": " << iTopSeps;
+	*MyProgressOut << ", \"memo_seps\": " << MySeps.size() << ", \"memo_succ_parts\": " << lSuccParts << ", \"memo_fail_parts\": " << lFailParts;
+	*MyProgressOut << ", \"decomp_calls\": " << lMyNbrOfCalls << ", \"separators\": " << lMyNbrOfSeps;
+	*MyProgressOut << ", \"calls_per_sec\": " << ((lInterval > 0) ? (lMyNbrOfCalls - lMyProgressCalls) * 1000000 / lInterval : 0);
+	*MyProgressOut << ", \"rss_kb\": " << getCurrentRSS() << ", \"memory\": " << MemoryAccount::getJSON() << "}" << endl;
+
+	MyLastProgress = Now;
+	lMyProgressCalls = lMyNbrOfCalls;
+}
+
+
+/*
+***Description***
+The method sets the file to which the state of the search is written periodically.
+
+INPUT:	cFile: Name of the checkpoint file (NULL if no checkpoints are written)
+		iInterval: Minimum number of seconds between two checkpoints
+*/
 
-	delete [] ParentSep;
+void DetKDecomp::setCheckpoint(char *cFile, int iInterval)
+{
+	cMyCheckpointFile = cFile;
+	iMyCheckpointInterval = iInterval;
+}
+
+
+/*
+***Description***
+The method sets the checkpoint file from which the next search is resumed.
+
+INPUT:	cFile: Name of the checkpoint file (NULL if the search starts from scratch)
+*/
+
+void DetKDecomp::setResume(char *cFile)
+{
+	cMyResumeFile = cFile;
+}
+
+
+/*
+***Description***
+The method sets the file into which the initial order of the hyperedges and the separators
+of a found decomposition are written (see writeRecord).
+
+INPUT:	cFile: Name of the record file (NULL if nothing is recorded)
+*/
+
+void DetKDecomp::setRecord(char *cFile)
+{
+	cMyRecordFile = cFile;
+}
+
+
+/*
+***Description***
+The method sets the record file from which the next decomposition is rebuilt. Instead of 
+searching, the recorded order of the hyperedges and the recorded separators are applied.
+
+INPUT:	cFile: Name of the record file (NULL if the decomposition is searched)
+*/
+
+void DetKDecomp::setReplay(char *cFile)
+{
+	cMyReplayFile = cFile;
+}
+
+
+/*
+***Description***
+The method sets the number of seconds after which the search is stopped.
+
+INPUT:	iSeconds: Time limit in seconds (0 if unlimited)
+*/
+
+void DetKDecomp::setTimeLimit(int iSeconds)
+{
+	lMyTimeLimit = (long long)iSeconds * 1000;
+}
+
+
+void DetKDecomp::setTimeLimitMs(long long lMilliseconds)
+{
+	lMyTimeLimit = lMilliseconds;
+}
+
+
+void DetKDecomp::setStopFlag(const atomic<bool> *StopFlag)
+{
+	MyStopFlag = StopFlag;
+}
+
+
+void DetKDecomp::setVerbose(bool bVerbose)
+{
+	bMyVerbose = bVerbose;
+}
+
+
+void DetKDecomp::setProfile(SearchProfile *Profile)
+{
+	MyProfile = Profile;
+}
+
+
+/*
+***Description***
+The method sets the stream to which the state of the running search is written periodically as
+one JSON object per line (see writeProgress).
+
+INPUT:	Out: Output stream (NULL if no progress records are written)
+		iInterval: Minimum number of seconds between two records
+*/
+
+void DetKDecomp::setProgress(ostream *Out, int iInterval)
+{
+	MyProgressOut = Out;
+	iMyProgressInterval = iInterval;
+}
+
+
+void DetKDecomp::setTrace(TraceWriter *Trace)
+{
+	MyTrace = Trace;
+}
+
+
+/*
+***Description***
+The method checks whether the last search was stopped before it finished, i.e., whether the
+time limit was exceeded or a stop was requested by a signal (see G_StopSearch) or by the stop
+flag.
+
+OUTPUT: return: true if the last search was stopped; otherwise false
+*/
+
+bool DetKDecomp::isStopped()
+{
+	return bMyStopped;
+}
+
+
+long long DetKDecomp::getNbrOfCalls()
+{
+	return lMyNbrOfCalls;
+}
+
+
+long long DetKDecomp::getNbrOfSeps()
+{
+	return lMyNbrOfSeps;
+}
+
+
+long long DetKDecomp::getNbrOfCutParts()
+{
+	return lMyNbrOfCutParts;
+}
+
+
+long long DetKDecomp::getOrderTime()
+{
+	return lMyOrderTime;
+}
+
+
+long long DetKDecomp::getSearchTime()
+{
+	return lMySearchTime;
+}
+
+
+long long DetKDecomp::getExpandTime()
+{
+	return lMyExpandTime;
 }
 
 
@@ -1038,11 +2286,13 @@ OUTPUT: return: Hypertree decomposition of HGraph
 
 Hypertree *DetKDecomp::buildHypertree(Hypergraph *HGraph, int iK)
 {
+	int i;
 	Hypertree *HTree;
-	Hyperedge **HEdges;
+	Hyperedge **HEdges, **RootSep;
 	Node *Connector[1];
-	list<Hyperedge **>::iterator ListIter;
-	list<list<Hyperedge *> *>::iterator ListIter1, ListIter2;
+	vector<Hyperedge **> RecordSeps;
+	list<Hypertree *> CutNodes;
+	chrono::steady_clock::time_point Start;
 
 	if(iK <= 0)
 		writeErrorMsg("Illegal hypertree-width.", "DetKDecomp::buildHypertree");
@@ -1050,37 +2300,103 @@ Hypertree *DetKDecomp::buildHypertree(Hypergraph *HGraph, int iK)
 	MyHGraph = HGraph;
 	iMyK = iK;
 
-	// Order hyperedges heuristically
-	HGraph->makeDual();
-	HEdges = (Hyperedge **)HGraph->getMCSOrder();
-	HGraph->makeDual();
+	Start = chrono::steady_clock::now();
+	if((cMyResumeFile == NULL) && (cMyReplayFile == NULL)) {
+		// Order hyperedges heuristically
+		HGraph->makeDual();
+		HEdges = (Hyperedge **)HGraph->getMCSOrder();
+		HGraph->makeDual();
+	}
+	else {
+		// Restore the order of the hyperedges and the state of the search from a checkpoint
+		// resp. the order and the separators from a record file
+		HEdges = new Hyperedge*[HGraph->getNbrOfEdges()+1];
+		if(HEdges == NULL)
+			writeErrorMsg("Error assigning memory.", "DetKDecomp::buildHypertree");
+		cMyReplayFile != NULL ? readRecord(HEdges) : readCheckpoint(HEdges);
+	}
 
 	// Store initial heuristic order as weight
-	for(int i=0; i < HGraph->getNbrOfEdges(); i++)
+	for(i=0; i < HGraph->getNbrOfEdges(); i++)
 		HEdges[i]->setWeight(i);
+	lMyOrderTime = microsecondsSince(Start);
 
-	// Build hypertree decomposition
+	// Build hypertree decomposition; between two separator choices, write checkpoints and
+	// stop the search if the time limit is exceeded or if a signal or stop flag was received
 	Connector[0] = NULL;
-	HTree = decomp(HEdges, Connector, 0);
-	delete [] HEdges;
+	bMyStopped = false;
+	lMyNbrOfCalls = lMyNbrOfSeps = lMyNbrOfCutParts = 0;
+	MyStart = chrono::steady_clock::now();
+	MyLastCheckpoint = MyStart;
+	MyLastProgress = MyStart;
+	lMyProgressCalls = 0;
+	if(cMyReplayFile != NULL) {
+		// Apply the recorded separators instead of searching
+		iMyReplayPos = 0;
+		MyResult = replay(HEdges, Connector, 0);
+		if(iMyReplayPos != (int)MyReplaySeps.size())
+			writeErrorMsg("Record file does not match the input.", "DetKDecomp::buildHypertree");
+	}
+	else {
+		pushFrame(HEdges, Connector, 0);
+		while(!step(0))
+			if((MyStack.back()->iState == DS_SEPARATE) || (MyStack.back()->iState == DS_COVER)) {
+				if(G_StopSearch || ((MyStopFlag != NULL) && *MyStopFlag) || ((lMyTimeLimit > 0) && (chrono::steady_clock::now() - MyStart >= chrono::milliseconds(lMyTimeLimit)))) {
+					bMyStopped = true;
+					break;
+				}
+				if((cMyCheckpointFile != NULL) && (MyStack.back()->iState == DS_SEPARATE) && (iMyResumePos >= (int)MyResume.size()) && (chrono::steady_clock::now() - MyLastCheckpoint >= chrono::seconds(iMyCheckpointInterval))) {
+					writeCheckpoint(HEdges);
+					MyLastCheckpoint = chrono::steady_clock::now();
+				}
+				if((MyProgressOut != NULL) && (chrono::steady_clock::now() - MyLastProgress >= chrono::seconds(iMyProgressInterval)))
+					writeProgress();
+			}
+	}
+
+	if(bMyStopped) {
+		// Save the state of the search and abandon it
+		if((cMyCheckpointFile != NULL) && (iMyResumePos >= (int)MyResume.size()))
+			writeCheckpoint(HEdges);
+		clearStack();
+		HTree = NULL;
+	}
+	else
+		HTree = MyResult;
+	RootSep = MyLastSep;
+	lMySearchTime = microsecondsSince(MyStart);
 
 	// Expand pruned hypertree nodes
-	if((HTree != NULL) && (HTree->getCutNode() != NULL)) {
-		cout << "Expanding hypertree ..." << endl;
-		expandHTree(HTree);
+	Start = chrono::steady_clock::now();
+	if(HTree != NULL)
+		HTree->getCutNodes(&CutNodes);
+	if(!CutNodes.empty()) {
+		if(bMyVerbose)
+			cout << "Expanding hypertree ..." << endl;
+		expandHTree(&CutNodes);
 	}
+	lMyExpandTime = microsecondsSince(Start);
+
+	// Record the order of the hyperedges and the separators of the decomposition
+	if((HTree != NULL) && (cMyRecordFile != NULL)) {
+		if(cMyReplayFile != NULL)
+			RecordSeps = MyReplaySeps;
+		else
+			collectSeps(HEdges, RootSep, &RecordSeps);
+		writeRecord(HEdges, &RecordSeps);
+	}
+	delete [] HEdges;
 
 	// Free memory
-	for(ListIter=MySeps.begin(); ListIter != MySeps.end(); ListIter++)
-		delete [] *ListIter;
-	MySeps.clear();
-
-	for(ListIter1=MySuccSepParts.begin(), ListIter2=MyFailSepParts.begin(); ListIter1 != MySuccSepParts.end(); ListIter1++, ListIter2++) {
-		delete *ListIter1;
-		delete *ListIter2;
-	}
-	MySuccSepParts.clear();
-	MyFailSepParts.clear();
+	clearSeps();
+	for(i=0; i < (int)MyResume.size(); i++)
+		delete [] MyResume[i].CovSepSet;
+	MyResume.clear();
+
+	for(i=0; i < (int)MyReplaySeps.size(); i++)
+		delete [] MyReplaySeps[i];
+	MyReplaySeps.clear();
+	iMyResumePos = 0;
 
 	return HTree;
 }
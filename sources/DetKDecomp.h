@@ -6,14 +6,115 @@
 #define CLS_DetKDecomp
 
 
+#include <list>
+#include <vector>
+#include <atomic>
+#include <chrono>
+#include <ostream>
+
+using namespace std;
+
 class Hypergraph;
 class Hyperedge;
 class Hypertree;
 class Node;
 class CompSet;
+class SearchProfile;
+class TraceWriter;
+
+
+// Positions within the body of a decomp call at which the search can be suspended
+enum DecompState { DS_ENTER, DS_COVER, DS_SEPARATE, DS_PART, DS_CHILD, DS_PARTS_DONE, DS_NEXT_ADD, DS_NEXT_COVER, DS_FINISH };
+
+
+// Models the local state of a single decomp call on the explicit search stack
+struct DecompFrame
+{
+	// Position within the decomp body at which the search continues
+	DecompState iState;
+
+	// Hyperedges in the subgraph
+	Hyperedge **HEdges;
+
+	// Connector nodes that must be covered
+	Node **Connector;
+
+	// Recursion level
+	int iRecLevel;
+
+	// Number of hyperedges in HEdges
+	int iNbrOfEdges;
+
+	// Inner hyperedges, boundary hyperedges, and candidates for an additional separator edge
+	Hyperedge **InnerEdges, **BoundEdges, **AddEdges;
+
+	// Sizes of the arrays above; iCompEnd separates boundary hyperedges inside and outside HEdges
+	int iInnerSize, iBoundSize, iAddSize, iCompEnd;
+
+	// Actual selection of covering hyperedges in BoundEdges (terminated by -1)
+	int *CovSepSet;
+
+	// Accumulated cover weights and positions of the boundary hyperedges
+	int *CovWeights;
+	bool *bInComp;
+
+	// Number of selected covering hyperedges, position in AddEdges, and separator size
+	int iNbrSelCov, iAddEdge, iSepSize;
+
+	// Indicates whether an additional hyperedge in AddEdges completes the separator
+	bool bAddEdge;
+
+	// Indicates whether the actual selection was restored from a checkpoint
+	bool bResume;
+
+	// Indicates whether the decomp call is written to the trace
+	bool bTraced;
+
+	// Actual separator and its memo entries
+	Hyperedge **Separator;
+	list<Hyperedge *> *SuccParts, *FailParts;
+	list<Hyperedge **> *SuccSeps;
+
+	// Partitions of HEdges with respect to the actual separator
+	Hyperedge ***Partitions;
+	Node ***ChildConnectors;
+	bool *bCutParts;
+	int iNbrOfParts;
+
+	// Separators needed to rebuild the pruned partitions
+	Hyperedge ***CutSeps;
+
+	// Actual partition
+	int iPart;
+
+	// Subtrees built for the partitions processed so far
+	list<Hypertree *> Subtrees;
+
+	// Hypertree built for the actual partition resp. for HEdges
+	Hypertree *HTree;
+
+	// Bytes of the frame and its auxiliary arrays and bytes of the partitions added to the memory account
+	long long lBytes, lPartBytes;
+};
+
+
+// Enumeration state of a decomp call stored in a checkpoint
+struct ResumeFrame
+{
+	// Selection of covering hyperedges (terminated by -1) and their number
+	int *CovSepSet;
+	int iNbrSelCov;
+
+	// Position in AddEdges and partition decomposed at the time of the checkpoint (-1 if none)
+	int iAddEdge, iPart;
+};
+
 
 class DetKDecomp
 {
+	// The microbenchmarks time the search kernels on subproblems captured during a search
+	friend class KernelBench;
+
 private:
 	// Underlying hypergraph
 	Hypergraph *MyHGraph;
@@ -27,9 +128,80 @@ private:
 	// Separator component already successfully decomposed
 	list<list<Hyperedge *> *> MySuccSepParts;
 
+	// Separators chosen at the root of the successfully decomposed components;
+	// the entries correspond to the entries in MySuccSepParts (NULL for trivial components)
+	list<list<Hyperedge **> *> MySuccSepChoices;
+
 	// Separator component not decomposable
 	list<list<Hyperedge *> *> MyFailSepParts;
 
+	// Separator chosen at the root of the last successfully decomposed component
+	Hyperedge **MyLastSep;
+
+	// Bytes of the separators and memo lists above added to the memory account
+	long long lMyMemoBytes;
+
+	// Bytes of the partitions and connectors created by the last call of separate
+	long long lMyPartBytes;
+
+	// Explicit search stack; the last frame is the active decomp call
+	vector<DecompFrame *> MyStack;
+
+	// Result of the last finished decomp call
+	Hypertree *MyResult;
+
+	// Checkpoint file and minimum number of seconds between two checkpoints
+	char *cMyCheckpointFile;
+	int iMyCheckpointInterval;
+	chrono::steady_clock::time_point MyLastCheckpoint;
+
+	// Checkpoint file to resume from
+	char *cMyResumeFile;
+
+	// Frames restored from a checkpoint and number of frames already continued
+	vector<ResumeFrame> MyResume;
+	int iMyResumePos;
+
+	// File into which the chosen separators are recorded and file from which they are replayed
+	char *cMyRecordFile, *cMyReplayFile;
+
+	// Separators read from the replay file in the order of their use and number of separators used
+	vector<Hyperedge **> MyReplaySeps;
+	int iMyReplayPos;
+
+	// Time limit in milliseconds (0 if unlimited) and start time of the search
+	long long lMyTimeLimit;
+	chrono::steady_clock::time_point MyStart;
+
+	// Indicates whether the last search was stopped before it finished
+	bool bMyStopped;
+
+	// Flag by which another thread can stop the search (NULL if not used)
+	const atomic<bool> *MyStopFlag;
+
+	// Indicates whether progress messages are written to the standard output
+	bool bMyVerbose;
+
+	// Number of decomp calls, examined separators, and pruned components in the last search
+	long long lMyNbrOfCalls, lMyNbrOfSeps, lMyNbrOfCutParts;
+
+	// Times in microseconds for ordering the hyperedges, searching, and expanding pruned hypertree
+	// nodes in the last search
+	long long lMyOrderTime, lMySearchTime, lMyExpandTime;
+
+	// Counters of the search per recursion level (NULL if the search is not profiled)
+	SearchProfile *MyProfile;
+
+	// Stream to which progress records are written (NULL if disabled), minimum number of seconds
+	// between two records, and time and number of decomp calls at the last record
+	ostream *MyProgressOut;
+	int iMyProgressInterval;
+	chrono::steady_clock::time_point MyLastProgress;
+	long long lMyProgressCalls;
+
+	// Trace into which the decomp calls and their expensive steps are written (NULL if disabled)
+	TraceWriter *MyTrace;
+
 	// Initializes a Boolean array representing a subset selection
 	int setInitSubset(Node **Nodes, Hyperedge **Edges, int *Set, bool *bInComp, int *CovWeights, int iSize);
 
@@ -55,7 +227,19 @@ private:
 	int divideCompEdges(Hyperedge **HEdges, Node **Nodes, Hyperedge ***Inner, Hyperedge ***Bound);
 
 	// Returns the partitions to a given separator that are known to be decomposable or undecomposable
-	bool getSepParts(int iSepSize, Hyperedge ***Separator, list<Hyperedge *> **SuccParts, list<Hyperedge *> **FailParts);
+	bool getSepParts(int iSepSize, Hyperedge ***Separator, list<Hyperedge *> **SuccParts, list<Hyperedge **> **SuccSeps, list<Hyperedge *> **FailParts);
+
+	// Returns the separator stored for the successfully decomposed component labeled with iLabel
+	bool getSuccSep(list<Hyperedge *> *SuccParts, list<Hyperedge **> *SuccSeps, int iLabel, Hyperedge ***Separator);
+
+	// Deletes the separators already used and their memo entries
+	void clearSeps();
+
+	// Adds bytes of the separators already used or their memo entries to the memory account
+	void accountMemo(long long lBytes);
+
+	// Removes the bytes of a frame or of its partitions from the memory account
+	void releaseFrame(DecompFrame *Frame, bool bPartsOnly);
 
 	// Checks whether HEdges contains an edge labeled with iLabel
 	bool containsLabel(list<Hyperedge *> *HEdges, int iLabel);
@@ -63,11 +247,47 @@ private:
 	// Checks whether the parent connector nodes are distributed to different components
 	bool isSplitSep(Node **Connector, Node ***ChildConnectors);
 
+	// Pushes a new decomp call onto the search stack
+	void pushFrame(Hyperedge **HEdges, Node **Connector, int iRecLevel);
+
+	// Executes the next step of the active decomp call on the search stack
+	bool step(int iBaseDepth);
+
+	// Removes all decomp calls from the search stack
+	void clearStack();
+
+	// Continues a decomp call with the enumeration state restored from a checkpoint
+	void restoreFrame(DecompFrame *Frame);
+
+	// Writes the search stack and the separator tables to the checkpoint file
+	void writeCheckpoint(Hyperedge **HEdges);
+
+	// Reads the search stack and the separator tables from the resume file
+	void readCheckpoint(Hyperedge **HEdges);
+
+	// Writes a progress record of the running search
+	void writeProgress();
+
+	// Collects the separators of a decomposition rebuilt from the stored separators in preorder
+	void collectSeps(Hyperedge **HEdges, Hyperedge **Separator, vector<Hyperedge **> *Seps);
+
+	// Writes the order of the hyperedges and the chosen separators to the record file
+	void writeRecord(Hyperedge **HEdges, vector<Hyperedge **> *Seps);
+
+	// Reads the order of the hyperedges and the chosen separators from the replay file
+	void readRecord(Hyperedge **HEdges);
+
 	// Builds a hypertree decomposition according to k-decomp by covering connector nodes
 	Hypertree *decomp(Hyperedge **HEdges, Node **Connector, int iRecLevel);
 
+	// Rebuilds the hypertree decomposition of a component from the stored separators
+	Hypertree *rebuild(Hyperedge **HEdges, Node **Connector, Hyperedge **Separator, int iRecLevel);
+
+	// Rebuilds the hypertree decomposition of a component from the separators of the replay file
+	Hypertree *replay(Hyperedge **HEdges, Node **Connector, int iRecLevel);
+
 	// Expands cut hypertree nodes
-	void expandHTree(Hypertree *HTree);
+	void expandHTree(list<Hypertree *> *CutNodes);
 
 public:
 	// Constructor
@@ -76,6 +296,56 @@ public:
 	// Destructor
 	virtual ~DetKDecomp();
 
+	// Sets the file to which checkpoints are written every iInterval seconds
+	void setCheckpoint(char *cFile, int iInterval);
+
+	// Sets the checkpoint file from which the search is resumed
+	void setResume(char *cFile);
+
+	// Sets the file into which the order of the hyperedges and the chosen separators are recorded
+	void setRecord(char *cFile);
+
+	// Sets the record file from which the decomposition is rebuilt without search
+	void setReplay(char *cFile);
+
+	// Sets the number of seconds after which the search is stopped (0 if unlimited)
+	void setTimeLimit(int iSeconds);
+
+	// Sets the number of milliseconds after which the search is stopped (0 if unlimited)
+	void setTimeLimitMs(long long lMilliseconds);
+
+	// Sets a flag by which another thread can stop the search
+	void setStopFlag(const atomic<bool> *StopFlag);
+
+	// Enables or disables progress messages on the standard output
+	void setVerbose(bool bVerbose);
+
+	// Sets the profile into which the counters of the search are accumulated (NULL to disable)
+	void setProfile(SearchProfile *Profile);
+
+	// Sets the stream to which a progress record is written every iInterval seconds (NULL to disable)
+	void setProgress(ostream *Out, int iInterval);
+
+	// Sets the trace into which the spans of the search are written (NULL to disable)
+	void setTrace(TraceWriter *Trace);
+
+	// Checks whether the last search was stopped by the time limit, a signal, or the stop flag
+	bool isStopped();
+
+	// Returns the number of decomp calls in the last search
+	long long getNbrOfCalls();
+
+	// Returns the number of separators examined in the last search
+	long long getNbrOfSeps();
+
+	// Returns the number of components pruned in the last search
+	long long getNbrOfCutParts();
+
+	// Return the times in microseconds for ordering, searching, and expanding in the last search
+	long long getOrderTime();
+	long long getSearchTime();
+	long long getExpandTime();
+
 	// Constructs a hypertree decomposition of width at most iK (if it exists)
 	Hypertree *buildHypertree(Hypergraph *HGraph, int iK);
 };
@@ -0,0 +1,195 @@
+// FileWriter.cpp: implementation of the FileWriter class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#else
+#include <io.h>
+#define fdopen _fdopen
+#define dup _dup
+#endif
+
+#include "FileWriter.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+FileWriter::FileWriter()
+{
+	MyFile = NULL;
+	iMyPos = 0;
+	bMyError = false;
+}
+
+
+FileWriter::~FileWriter()
+{
+	close();
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+void FileWriter::flush()
+{
+	if((iMyPos > 0) && (fwrite(cMyBuffer, 1, iMyPos, MyFile) != (size_t)iMyPos))
+		bMyError = true;
+	iMyPos = 0;
+}
+
+
+bool FileWriter::open(const char *cNameOfFile)
+{
+	close();
+
+	MyFile = fopen(cNameOfFile, "wb");
+	if(MyFile == NULL)
+		return false;
+
+	// The output is buffered in cMyBuffer only
+	setvbuf(MyFile, NULL, _IONBF, 0);
+	iMyPos = 0;
+	bMyError = false;
+
+	return true;
+}
+
+
+bool FileWriter::open(int iDescriptor)
+{
+	int iCopy;
+
+	close();
+
+	// Write into a copy of the descriptor such that closing the writer does not close the original
+	if((iCopy = dup(iDescriptor)) < 0)
+		return false;
+	MyFile = fdopen(iCopy, "wb");
+	if(MyFile == NULL) {
+		::close(iCopy);
+		return false;
+	}
+
+	setvbuf(MyFile, NULL, _IONBF, 0);
+	iMyPos = 0;
+	bMyError = false;
+
+	return true;
+}
+
+
+bool FileWriter::close()
+{
+	if(MyFile != NULL) {
+		flush();
+		if(fclose(MyFile) != 0)
+			bMyError = true;
+		MyFile = NULL;
+	}
+
+	return !bMyError;
+}
+
+
+FileWriter &FileWriter::operator<<(const char *cString)
+{
+	int iLength = (int)strlen(cString);
+
+	// Write long strings directly
+	if(iLength >= FW_BUFFER_SIZE) {
+		flush();
+		if(fwrite(cString, 1, iLength, MyFile) != (size_t)iLength)
+			bMyError = true;
+		return *this;
+	}
+
+	if(iMyPos + iLength > FW_BUFFER_SIZE)
+		flush();
+	memcpy(cMyBuffer + iMyPos, cString, iLength);
+	iMyPos += iLength;
+
+	return *this;
+}
+
+
+FileWriter &FileWriter::operator<<(char c)
+{
+	if(iMyPos == FW_BUFFER_SIZE)
+		flush();
+	cMyBuffer[iMyPos++] = c;
+
+	return *this;
+}
+
+
+FileWriter &FileWriter::operator<<(int iNumber)
+{
+	char cDigits[(sizeof(int)*8)+2];
+	int iLength = 0;
+	unsigned int iValue;
+
+	if(iMyPos + (int)sizeof(cDigits) > FW_BUFFER_SIZE)
+		flush();
+
+	if(iNumber < 0) {
+		cMyBuffer[iMyPos++] = '-';
+		iValue = 0U - (unsigned int)iNumber;
+	}
+	else
+		iValue = (unsigned int)iNumber;
+
+	// Compute the digits in reverse order
+	do {
+		cDigits[iLength++] = (char)('0' + (iValue % 10));
+		iValue /= 10;
+	} while(iValue > 0);
+
+	while(iLength > 0)
+		cMyBuffer[iMyPos++] = cDigits[--iLength];
+
+	return *this;
+}
+
+
+FileWriter &FileWriter::operator<<(long long lNumber)
+{
+	char cDigits[(sizeof(long long)*8)+2];
+	int iLength = 0;
+	unsigned long long lValue;
+
+	if(iMyPos + (int)sizeof(cDigits) > FW_BUFFER_SIZE)
+		flush();
+
+	if(lNumber < 0) {
+		cMyBuffer[iMyPos++] = '-';
+		lValue = 0ULL - (unsigned long long)lNumber;
+	}
+	else
+		lValue = (unsigned long long)lNumber;
+
+	// Compute the digits in reverse order
+	do {
+		cDigits[iLength++] = (char)('0' + (lValue % 10));
+		lValue /= 10;
+	} while(lValue > 0);
+
+	while(iLength > 0)
+		cMyBuffer[iMyPos++] = cDigits[--iLength];
+
+	return *this;
+}
@@ -0,0 +1,63 @@
+// Models a buffered output file into which strings and numbers are written sequentially.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_FILEWRITER)
+#define CLS_FILEWRITER
+
+#include <cstdio>
+
+
+#define FW_BUFFER_SIZE 65536
+
+
+class FileWriter
+{
+private:
+	// Output file
+	FILE *MyFile;
+
+	// Buffer collecting the output before it is written into the file
+	char cMyBuffer[FW_BUFFER_SIZE];
+
+	// Number of characters in the buffer
+	int iMyPos;
+
+	// Indicates whether writing into the file failed
+	bool bMyError;
+
+	// Writes the contents of the buffer into the file
+	void flush();
+
+public:
+	// Constructor
+	FileWriter();
+
+	// Destructor
+	virtual ~FileWriter();
+
+	// Opens a file for writing; returns false if the file cannot be opened
+	bool open(const char *cNameOfFile);
+
+	// Opens an already open file descriptor (e.g., a socket) for writing; returns false on failure
+	bool open(int iDescriptor);
+
+	// Writes the remaining output and closes the file; returns false if writing failed
+	bool close();
+
+	// Writes a '\0'-terminated string
+	FileWriter &operator<<(const char *cString);
+
+	// Writes a character
+	FileWriter &operator<<(char c);
+
+	// Writes an integer in decimal notation
+	FileWriter &operator<<(int iNumber);
+
+	// Writes a long integer in decimal notation
+	FileWriter &operator<<(long long lNumber);
+};
+
+
+#endif // !defined(CLS_FILEWRITER)
@@ -0,0 +1,493 @@
+// FlatHypertree.cpp: implementation of the FlatHypertree class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <algorithm>
+#include <list>
+#include <set>
+
+using namespace std;
+
+#include "FlatHypertree.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "Hyperedge.h"
+#include "Node.h"
+#include "Globals.h"
+#include "FileWriter.h"
+#include "MemoryAccount.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The constructor flattens a hypertree in a single traversal: the hypertree nodes are numbered in
+preorder (the children in list order), and their chi- and lambda-sets are stored consecutively
+in the arena as sorted positions of the nodes and hyperedges in the hypergraph. The labels of
+the nodes and hyperedges of the hypergraph are overwritten by their positions. It is assumed
+that the hypertree is acyclic.
+
+INPUT:	HGraph: Hypergraph
+		HTree: Root of the hypertree
+		TNodes: Array in which the hypertree nodes are stored in preorder (or NULL)
+*/
+
+FlatHypertree::FlatHypertree(Hypergraph *HGraph, Hypertree *HTree, vector<Hypertree *> *TNodes)
+{
+	int t, i;
+	Hypertree *HT;
+	vector<pair<Hypertree *, int> > Stack;
+	set<Node *>::iterator ChiIter;
+	set<Hyperedge *>::iterator LambdaIter;
+	list<Hypertree *>::reverse_iterator ChildIter;
+
+	lMyBytes = 0;
+	for(i=0; i < HGraph->getNbrOfNodes(); i++)
+		HGraph->getNode(i)->setLabel(i);
+	for(i=0; i < HGraph->getNbrOfEdges(); i++)
+		HGraph->getEdge(i)->setLabel(i);
+	if(TNodes != NULL)
+		TNodes->clear();
+
+	Stack.push_back(make_pair(HTree, -1));
+	while(!Stack.empty()) {
+		t = (int)MyParents.size();
+		HT = Stack.back().first;
+		MyParents.push_back(Stack.back().second);
+		Stack.pop_back();
+		if(TNodes != NULL)
+			TNodes->push_back(HT);
+
+		MyChiStart.push_back((uint32_t)MyArena.size());
+		for(ChiIter=HT->getChi()->begin(); ChiIter != HT->getChi()->end(); ChiIter++)
+			MyArena.push_back((uint32_t)(*ChiIter)->getLabel());
+		sort(MyArena.begin()+MyChiStart[t], MyArena.end());
+		MyChiSize.push_back((uint32_t)MyArena.size()-MyChiStart[t]);
+
+		MyLambdaStart.push_back((uint32_t)MyArena.size());
+		for(LambdaIter=HT->getLambda()->begin(); LambdaIter != HT->getLambda()->end(); LambdaIter++)
+			MyArena.push_back((uint32_t)(*LambdaIter)->getLabel());
+		sort(MyArena.begin()+MyLambdaStart[t], MyArena.end());
+		MyLambdaSize.push_back((uint32_t)MyArena.size()-MyLambdaStart[t]);
+
+		// The children are pushed in reverse order such that they are numbered in list order
+		for(ChildIter=HT->getChildren()->rbegin(); ChildIter != HT->getChildren()->rend(); ChildIter++)
+			Stack.push_back(make_pair(*ChildIter, t));
+	}
+
+	setChildren();
+	account();
+}
+
+
+FlatHypertree::~FlatHypertree()
+{
+	MemoryAccount::sub(MEM_HYPERTREE, lMyBytes);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+void FlatHypertree::account()
+{
+	long long lBytes;
+
+	lBytes = sizeof(FlatHypertree) + (long long)(MyParents.capacity() + MyChildStart.capacity() + MyChildren.capacity())*sizeof(int);
+	lBytes += (long long)(MyChiStart.capacity() + MyChiSize.capacity() + MyLambdaStart.capacity() + MyLambdaSize.capacity())*sizeof(uint32_t);
+	lBytes += (long long)MyArena.capacity()*sizeof(uint32_t);
+
+	if(lBytes != lMyBytes) {
+		MemoryAccount::add(MEM_HYPERTREE, lBytes-lMyBytes);
+		lMyBytes = lBytes;
+	}
+}
+
+
+void FlatHypertree::setChildren()
+{
+	int iNbrOfNodes = (int)MyParents.size(), t;
+	vector<int> Next;
+
+	// Count the children of each node and distribute the nodes to their parents in preorder
+	MyChildStart.assign(iNbrOfNodes+1, 0);
+	for(t=1; t < iNbrOfNodes; t++)
+		++MyChildStart[MyParents[t]+1];
+	for(t=0; t < iNbrOfNodes; t++)
+		MyChildStart[t+1] += MyChildStart[t];
+	Next.assign(MyChildStart.begin(), MyChildStart.end()-1);
+	MyChildren.resize(iNbrOfNodes > 0 ? iNbrOfNodes-1 : 0);
+	for(t=1; t < iNbrOfNodes; t++)
+		MyChildren[Next[MyParents[t]]++] = t;
+}
+
+
+/*
+***Description***
+The method numbers the hypertree nodes reachable from the root again in preorder. The children
+are given by linked lists in which the first child of node t is FirstChild[t] and the next
+sibling of node t is NextSibling[t] (-1 if there is none). The chi- and lambda-sets are copied
+into a new arena such that the sets of removed nodes and replaced sets are released.
+
+INPUT:	FirstChild: First children of the nodes
+		NextSibling: Next siblings of the nodes
+OUTPUT: -
+*/
+
+void FlatHypertree::rebuild(vector<int> *FirstChild, vector<int> *NextSibling)
+{
+	int t, i;
+	long long lArenaSize = 0;
+	vector<int> Order, Parents;
+	vector<pair<int, int> > Stack;
+	vector<uint32_t> ChiStart, ChiSize, LambdaStart, LambdaSize, Arena;
+
+	// The next sibling is pushed before the first child such that the subtree is numbered first
+	Stack.push_back(make_pair(0, -1));
+	while(!Stack.empty()) {
+		t = Stack.back().first;
+		Parents.push_back(Stack.back().second);
+		Stack.pop_back();
+		Order.push_back(t);
+		lArenaSize += MyChiSize[t] + MyLambdaSize[t];
+
+		if((t != 0) && ((*NextSibling)[t] >= 0))
+			Stack.push_back(make_pair((*NextSibling)[t], Parents.back()));
+		if((*FirstChild)[t] >= 0)
+			Stack.push_back(make_pair((*FirstChild)[t], (int)Order.size()-1));
+	}
+
+	Arena.reserve((size_t)lArenaSize);
+	for(i=0; i < (int)Order.size(); i++) {
+		t = Order[i];
+		ChiStart.push_back((uint32_t)Arena.size());
+		ChiSize.push_back(MyChiSize[t]);
+		Arena.insert(Arena.end(), MyArena.begin()+MyChiStart[t], MyArena.begin()+MyChiStart[t]+MyChiSize[t]);
+		LambdaStart.push_back((uint32_t)Arena.size());
+		LambdaSize.push_back(MyLambdaSize[t]);
+		Arena.insert(Arena.end(), MyArena.begin()+MyLambdaStart[t], MyArena.begin()+MyLambdaStart[t]+MyLambdaSize[t]);
+	}
+
+	MyParents.swap(Parents);
+	MyChiStart.swap(ChiStart);
+	MyChiSize.swap(ChiSize);
+	MyLambdaStart.swap(LambdaStart);
+	MyLambdaSize.swap(LambdaSize);
+	MyArena.swap(Arena);
+	setChildren();
+}
+
+
+int FlatHypertree::remChild(int t, int c, int iPrev, vector<int> *FirstChild, vector<int> *NextSibling, vector<int> *LastChild)
+{
+	int iNext;
+
+	// Append the children of the removed child to the list of children
+	if((*FirstChild)[c] >= 0) {
+		(*NextSibling)[(*LastChild)[t]] = (*FirstChild)[c];
+		(*LastChild)[t] = (*LastChild)[c];
+	}
+
+	// Unlink the removed child
+	iNext = (*NextSibling)[c];
+	if(iPrev < 0)
+		(*FirstChild)[t] = iNext;
+	else
+		(*NextSibling)[iPrev] = iNext;
+	if((*LastChild)[t] == c)
+		(*LastChild)[t] = iPrev;
+
+	return iNext;
+}
+
+
+void FlatHypertree::writeNames(FileWriter &Writer, Hypergraph *HGraph, const uint32_t *Set, int iSize, bool bEdges)
+{
+	int i;
+
+	for(i=0; i < iSize; i++) {
+		if(i > 0)
+			Writer << ", ";
+		Writer << (bEdges ? HGraph->getEdge((int)Set[i])->getName() : HGraph->getNode((int)Set[i])->getName());
+	}
+}
+
+
+void FlatHypertree::outputToGML(Hypergraph *HGraph, char *cNameOfFile)
+{
+	FileWriter GMLFile;
+
+	// Check if file opening was successful
+	if(!GMLFile.open(cNameOfFile))
+		writeErrorMsg("Error opening file.", "FlatHypertree::outputToGML");
+
+	writeGML(GMLFile, HGraph);
+
+	if(!GMLFile.close())
+		writeErrorMsg("Error writing file.", "FlatHypertree::outputToGML");
+}
+
+
+void FlatHypertree::writeGML(FileWriter &GMLFile, Hypergraph *HGraph)
+{
+	int t;
+
+	GMLFile << "graph [\n\n";
+	GMLFile << "  directed 0\n\n";
+
+	// Write hypertree nodes in GML format
+	for(t=0; t < getNbrOfNodes(); t++) {
+		GMLFile << "  node [\n";
+		GMLFile << "    id " << t+1 << '\n';
+		GMLFile << "    label \"{";
+		writeNames(GMLFile, HGraph, getLambda(t), getLambdaSize(t), true);
+		GMLFile << "}    {";
+		writeNames(GMLFile, HGraph, getChi(t), getChiSize(t), false);
+		GMLFile << "}\"\n";
+		GMLFile << "    vgj [\n";
+		GMLFile << "      labelPosition \"in\"\n";
+		GMLFile << "      shape \"Rectangle\"\n";
+		GMLFile << "    ]\n";
+		GMLFile << "  ]\n\n";
+	}
+
+	// Write hypertree edges in GML format
+	for(t=1; t < getNbrOfNodes(); t++) {
+		GMLFile << "  edge [\n";
+		GMLFile << "    source " << MyParents[t]+1 << '\n';
+		GMLFile << "    target " << t+1 << '\n';
+		GMLFile << "  ]\n\n";
+	}
+
+	GMLFile << "]\n";
+}
+
+
+/*
+***Description***
+The method writes the hypertree in the PACE 2019 format for hypertree decompositions: a solution
+line "s htd <bags> <width> <nodes> <edges>", a line "b <bag> <nodes>" for each hypertree node
+with its chi-set, a line "<bag> <bag>" for each hypertree edge, and a line "w <bag> <edge> 1"
+for each edge in the lambda-set of a hypertree node. Bags are numbered from 1 in preorder, and
+nodes and edges are numbered from 1 by their positions in the hypergraph.
+
+INPUT:	HGraph: Hypergraph decomposed by the hypertree
+		cNameOfFile: Name of the output file
+OUTPUT: -
+*/
+
+void FlatHypertree::outputToPACE(Hypergraph *HGraph, char *cNameOfFile)
+{
+	FileWriter PACEFile;
+
+	// Check if file opening was successful
+	if(!PACEFile.open(cNameOfFile))
+		writeErrorMsg("Error opening file.", "FlatHypertree::outputToPACE");
+
+	writePACE(PACEFile, HGraph);
+
+	if(!PACEFile.close())
+		writeErrorMsg("Error writing file.", "FlatHypertree::outputToPACE");
+}
+
+
+void FlatHypertree::writePACE(FileWriter &PACEFile, Hypergraph *HGraph)
+{
+	int t, i;
+
+	PACEFile << "s htd " << getNbrOfNodes() << ' ' << getHTreeWidth() << ' ' << HGraph->getNbrOfNodes() << ' ' << HGraph->getNbrOfEdges() << '\n';
+	for(t=0; t < getNbrOfNodes(); t++) {
+		PACEFile << "b " << t+1;
+		for(i=0; i < getChiSize(t); i++)
+			PACEFile << ' ' << (int)getChi(t)[i]+1;
+		PACEFile << '\n';
+	}
+	for(t=1; t < getNbrOfNodes(); t++)
+		PACEFile << MyParents[t]+1 << ' ' << t+1 << '\n';
+	for(t=0; t < getNbrOfNodes(); t++)
+		for(i=0; i < getLambdaSize(t); i++)
+			PACEFile << "w " << t+1 << ' ' << (int)getLambda(t)[i]+1 << " 1\n";
+}
+
+
+int FlatHypertree::getNbrOfNodes()
+{
+	return (int)MyParents.size();
+}
+
+
+int FlatHypertree::getParent(int t)
+{
+	return MyParents[t];
+}
+
+
+int FlatHypertree::getNbrOfChildren(int t)
+{
+	return MyChildStart[t+1]-MyChildStart[t];
+}
+
+
+const int *FlatHypertree::getChildren(int t)
+{
+	return MyChildren.data()+MyChildStart[t];
+}
+
+
+int FlatHypertree::getChiSize(int t)
+{
+	return (int)MyChiSize[t];
+}
+
+
+const uint32_t *FlatHypertree::getChi(int t)
+{
+	return MyArena.data()+MyChiStart[t];
+}
+
+
+int FlatHypertree::getLambdaSize(int t)
+{
+	return (int)MyLambdaSize[t];
+}
+
+
+const uint32_t *FlatHypertree::getLambda(int t)
+{
+	return MyArena.data()+MyLambdaStart[t];
+}
+
+
+int FlatHypertree::getHTreeWidth()
+{
+	int iWidth = 0, t;
+
+	for(t=0; t < getNbrOfNodes(); t++)
+		iWidth = max(iWidth, (int)MyLambdaSize[t]);
+
+	return iWidth;
+}
+
+
+int FlatHypertree::getTreeWidth()
+{
+	int iWidth = -1, t;
+
+	for(t=0; t < getNbrOfNodes(); t++)
+		iWidth = max(iWidth, (int)MyChiSize[t]-1);
+
+	return iWidth;
+}
+
+
+/*
+***Description***
+The method removes redundant hypertree nodes in the same way as Hypertree::shrink: each node
+whose chi-set is a subset of the chi-set of a child takes over the chi- and lambda-set of the
+child, and each child whose chi-set is a subset of the chi-set of the node is removed; the
+children of removed nodes are appended to the children of the node. The nodes are processed
+in reverse preorder such that all descendants of a node are processed before the node.
+Subsets are tested by merging the sorted sets. A chi-set taken over from a child is shared in
+the arena, and the lambda-set of a node is collected in a buffer and written into the arena
+only once; finally, the remaining nodes are numbered in preorder and the arena is compacted.
+
+INPUT:	bLambdaUnion: true if the lambda-sets of removed children are added to the lambda-set
+		of the node; false if the node only takes over the lambda-set of a child with a
+		larger chi-set
+OUTPUT: -
+*/
+
+void FlatHypertree::shrink(bool bLambdaUnion)
+{
+	int iNbrOfNodes = getNbrOfNodes(), iPrev, t, c, i;
+	bool bChanged;
+	vector<int> FirstChild, NextSibling, LastChild;
+	vector<uint32_t> Lambda;
+
+	if(iNbrOfNodes == 0)
+		return;
+
+	// Store the children as linked lists such that children can be appended and removed
+	FirstChild.assign(iNbrOfNodes, -1);
+	NextSibling.assign(iNbrOfNodes, -1);
+	LastChild.assign(iNbrOfNodes, -1);
+	for(t=0; t < iNbrOfNodes; t++)
+		for(i=MyChildStart[t]; i < MyChildStart[t+1]; i++) {
+			c = MyChildren[i];
+			if(LastChild[t] < 0)
+				FirstChild[t] = c;
+			else
+				NextSibling[LastChild[t]] = c;
+			LastChild[t] = c;
+		}
+
+	for(t=iNbrOfNodes-1; t >= 0; t--) {
+		if(FirstChild[t] < 0)
+			continue;
+		Lambda.assign(getLambda(t), getLambda(t)+getLambdaSize(t));
+		bChanged = false;
+
+		// Remove the actual node if its chi-set is a subset of the chi-set of one of its children
+		for(iPrev=-1, c=FirstChild[t]; c >= 0;)
+			if(includes(getChi(c), getChi(c)+getChiSize(c), getChi(t), getChi(t)+getChiSize(t))) {
+
+				// Move the chi- and lambda-set from the child to the actual node
+				MyChiStart[t] = MyChiStart[c];
+				MyChiSize[t] = MyChiSize[c];
+				if(!bLambdaUnion)
+					Lambda.clear();
+				Lambda.insert(Lambda.end(), getLambda(c), getLambda(c)+getLambdaSize(c));
+				bChanged = true;
+
+				c = remChild(t, c, iPrev, &FirstChild, &NextSibling, &LastChild);
+			}
+			else {
+				iPrev = c;
+				c = NextSibling[c];
+			}
+
+		// Remove all child nodes whose chi-sets are subsets of the chi-set of the actual node
+		for(iPrev=-1, c=FirstChild[t]; c >= 0;)
+			if(includes(getChi(t), getChi(t)+getChiSize(t), getChi(c), getChi(c)+getChiSize(c))) {
+
+				// Move the lambda-set from the child to the actual node
+				if(bLambdaUnion) {
+					Lambda.insert(Lambda.end(), getLambda(c), getLambda(c)+getLambdaSize(c));
+					bChanged = true;
+				}
+
+				c = remChild(t, c, iPrev, &FirstChild, &NextSibling, &LastChild);
+			}
+			else {
+				iPrev = c;
+				c = NextSibling[c];
+			}
+
+		if(bChanged) {
+			sort(Lambda.begin(), Lambda.end());
+			Lambda.erase(unique(Lambda.begin(), Lambda.end()), Lambda.end());
+			MyLambdaStart[t] = (uint32_t)MyArena.size();
+			MyLambdaSize[t] = (uint32_t)Lambda.size();
+			MyArena.insert(MyArena.end(), Lambda.begin(), Lambda.end());
+		}
+	}
+
+	rebuild(&FirstChild, &NextSibling);
+	account();
+}
+
+
+void FlatHypertree::swapChiLambda()
+{
+	MyChiStart.swap(MyLambdaStart);
+	MyChiSize.swap(MyLambdaSize);
+}
@@ -0,0 +1,116 @@
+// Models a hypertree stored in flat arrays: the nodes are numbered in preorder, the chi- and
+// lambda-sets are sorted spans of positions of nodes and hyperedges in a shared arena, and the
+// children are stored in compressed form.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_FLATHYPERTREE)
+#define CLS_FLATHYPERTREE
+
+#include <cstdint>
+#include <vector>
+
+using namespace std;
+
+class Hypergraph;
+class Hypertree;
+class FileWriter;
+
+class FlatHypertree
+{
+private:
+	// Positions of the parents in preorder (-1 for the root)
+	vector<int> MyParents;
+
+	// Children of the hypertree nodes; the children of position t are MyChildren[MyChildStart[t]],
+	// ..., MyChildren[MyChildStart[t+1]-1] in the order of the original list of children
+	vector<int> MyChildStart, MyChildren;
+
+	// Starts and sizes of the chi- and lambda-sets in the arena
+	vector<uint32_t> MyChiStart, MyChiSize, MyLambdaStart, MyLambdaSize;
+
+	// Positions of the nodes and hyperedges in the hypergraph, in ascending order within each set
+	vector<uint32_t> MyArena;
+
+	// Number of bytes of the arrays added to the memory account
+	long long lMyBytes;
+
+	// Updates the memory account by the bytes of the arrays
+	void account();
+
+	// Computes the children of the hypertree nodes from their parents
+	void setChildren();
+
+	// Numbers the hypertree nodes again in preorder from lists of children given by first
+	// children and next siblings; the sets are copied into a new arena
+	void rebuild(vector<int> *FirstChild, vector<int> *NextSibling);
+
+	// Removes child c (with predecessor iPrev) from the list of children of node t, appends the
+	// children of c to the list, and returns the successor of c
+	int remChild(int t, int c, int iPrev, vector<int> *FirstChild, vector<int> *NextSibling, vector<int> *LastChild);
+
+	// Writes the nodes or the hyperedges of a set separated by commas
+	void writeNames(FileWriter &Writer, Hypergraph *HGraph, const uint32_t *Set, int iSize, bool bEdges);
+
+public:
+	// Constructor; flattens a hypertree over a hypergraph (the labels of the nodes and hyperedges
+	// are overwritten) and stores its nodes in preorder in TNodes if TNodes is not NULL
+	FlatHypertree(Hypergraph *HGraph, Hypertree *HTree, vector<Hypertree *> *TNodes = NULL);
+
+	// Destructor
+	virtual ~FlatHypertree();
+
+	// Writes hypertree to GML format file
+	void outputToGML(Hypergraph *HGraph, char *cNameOfFile);
+
+	// Writes hypertree to PACE format file (.htd or .ghd)
+	void outputToPACE(Hypergraph *HGraph, char *cNameOfFile);
+
+	// Writes the hypertree in GML format into an open writer
+	void writeGML(FileWriter &GMLFile, Hypergraph *HGraph);
+
+	// Writes the hypertree in PACE format into an open writer
+	void writePACE(FileWriter &PACEFile, Hypergraph *HGraph);
+
+	// Returns the number of hypertree nodes
+	int getNbrOfNodes();
+
+	// Returns the position of the parent (-1 for the root)
+	int getParent(int t);
+
+	// Returns the number of children
+	int getNbrOfChildren(int t);
+
+	// Returns the positions of the children
+	const int *getChildren(int t);
+
+	// Returns the number of nodes in the chi-set
+	int getChiSize(int t);
+
+	// Returns the positions of the nodes in the chi-set in ascending order
+	const uint32_t *getChi(int t);
+
+	// Returns the number of hyperedges in the lambda-set
+	int getLambdaSize(int t);
+
+	// Returns the positions of the hyperedges in the lambda-set in ascending order
+	const uint32_t *getLambda(int t);
+
+	// Returns the hypertreewidth, i.e., the maximum number of elements
+	// in the lambda-set over all nodes
+	int getHTreeWidth();
+
+	// Returns the treewidth, i.e., the maximum number of elements
+	// in the chi-set over all nodes minus one
+	int getTreeWidth();
+
+	// Removes redundant nodes
+	void shrink(bool bLambdaUnion = false);
+
+	// Swaps all chi- and lambda-sets
+	void swapChiLambda();
+};
+
+
+#endif // !defined(CLS_FLATHYPERTREE)
@@ -4,6 +4,15 @@
 
 #include <iostream>
 #include <cstdlib>
+#include <cstdio>
+#include <string>
+#include <stdexcept>
+#include <chrono>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 
@@ -15,10 +24,27 @@ using namespace std;
 #include "Node.h"
 
 
+volatile sig_atomic_t G_StopSearch = 0;
+thread_local bool G_ThrowErrors = false;
+
+// State of the random number generator of each thread (an additive feedback generator 
+// x[i] = x[i-3] + x[i-31] producing the same sequence as rand() of the GNU C library)
+struct RandomState
+{
+	int iState[34];
+	int iPos;
+	bool bInit;
+};
+
+static thread_local RandomState G_Random = { {0}, 0, false };
+
+
 
 void writeErrorMsg(const char *cMessage, const char *cLocation, bool bExitProgram)
 { 
 	if(bExitProgram) {
+		if(G_ThrowErrors)
+			throw runtime_error(string(cLocation) + ": " + cMessage);
 		cerr << "ERROR in " << cLocation << ": " << cMessage << endl; 
 		exit(EXIT_FAILURE);
 	}
@@ -242,6 +268,115 @@ bool isSubset(set<Hyperedge *> *Set1, set<Hyperedge *> *Set2)
 }
 
 
+long long microsecondsSince(chrono::steady_clock::time_point Start)
+{
+	return (long long)chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - Start).count();
+}
+
+
+string toJSON(const string &Text)
+{
+	string Result = "\"";
+	char cHex[8];
+
+	for(size_t i=0; i < Text.size(); i++)
+		switch(Text[i]) {
+			case '"': Result += "\\\""; break;
+			case '\\': Result += "\\\\"; break;
+			case '\n': Result += "\\n"; break;
+			case '\t': Result += "\\t"; break;
+			default:
+				if((unsigned char)Text[i] < 0x20) {
+					sprintf(cHex, "\\u%04x", (unsigned char)Text[i]);
+					Result += cHex;
+				}
+				else
+					Result += Text[i];
+		}
+
+	return Result + "\"";
+}
+
+
+long long getPeakRSS()
+{
+#if !defined(_WIN32)
+	struct rusage Usage;
+
+	// Linux reports the maximum resident set size in kilobytes
+	if(getrusage(RUSAGE_SELF, &Usage) == 0)
+		return (long long)Usage.ru_maxrss;
+#endif
+	return 0;
+}
+
+
+/*
+***Description***
+The function returns the current resident set size of the process as given by the second field
+of /proc/self/statm (in pages). On systems without this file, the peak size is returned.
+
+OUTPUT: return: Resident set size in kilobytes
+*/
+
+long long getCurrentRSS()
+{
+#if !defined(_WIN32)
+	long long lSize, lPages;
+	FILE *File = fopen("/proc/self/statm", "r");
+
+	if(File != NULL) {
+		if(fscanf(File, "%lld %lld", &lSize, &lPages) == 2) {
+			fclose(File);
+			return lPages * (sysconf(_SC_PAGESIZE) / 1024);
+		}
+		fclose(File);
+	}
+#endif
+	return getPeakRSS();
+}
+
+
+void random_init(unsigned int iSeed)
+{
+	int i;
+	long long iWord;
+
+	// Fill the state by a linear congruential generator
+	G_Random.iState[0] = (iSeed == 0) ? 1 : (int)iSeed;
+	for(i=1; i < 31; i++) {
+		iWord = (16807LL * (G_Random.iState[i-1] % 127773)) - (2836LL * (G_Random.iState[i-1] / 127773));
+		if(iWord < 0)
+			iWord += 2147483647;
+		G_Random.iState[i] = (int)iWord;
+	}
+	for(i=31; i < 34; i++)
+		G_Random.iState[i] = G_Random.iState[i-31];
+	G_Random.iPos = 0;
+	G_Random.bInit = true;
+
+	// Discard the first values
+	for(i=0; i < 310; i++)
+		random_next();
+}
+
+
+int random_next()
+{
+	unsigned int iValue;
+
+	if(!G_Random.bInit)
+		random_init(1);
+
+	// The state is a ring buffer holding the last 34 values; iPos refers to the oldest one
+	iValue = (unsigned int)G_Random.iState[(G_Random.iPos+3) % 34] + (unsigned int)G_Random.iState[(G_Random.iPos+31) % 34];
+	G_Random.iState[G_Random.iPos] = (int)iValue;
+	G_Random.iPos = (G_Random.iPos+1) % 34;
+
+	return (int)(iValue >> 1);
+}
+
+
 int random_range(int iLB, int iUB)
 {
 	int iRange;
@@ -250,6 +385,6 @@ int random_range(int iLB, int iUB)
 		writeErrorMsg("Lower bound larger than upper bound.", "random_range");
 
 	iRange = (iUB - iLB) + 1;
-	return iLB + (int)(iRange * (rand() / (RAND_MAX + 1.0)));
+	return iLB + (int)(iRange * (random_next() / (RANDOM_MAX + 1.0)));
 }
 
@@ -8,7 +8,13 @@
 
 #define REAL double
 
+// Largest value returned by random_next
+#define RANDOM_MAX 2147483647
+
 #include <set>
+#include <string>
+#include <csignal>
+#include <chrono>
 
 using namespace std;
 
@@ -19,6 +25,14 @@ class Hyperedge;
 class Node;
 
 
+// Indicates that the search was requested to stop (set by signal handlers)
+extern volatile sig_atomic_t G_StopSearch;
+
+// Indicates that fatal errors of the calling thread are thrown as runtime_error instead of 
+// aborting the program (used if several instances are processed in one process)
+extern thread_local bool G_ThrowErrors;
+
+
 // Writes an error message to the standard error output stream
 void writeErrorMsg(const char *cMessage, const char *cLocation, bool bExitProgram = true);
 
@@ -43,6 +57,24 @@ bool isSubset(set<Node *> *Set1, set<Node *> *Set2);
 // Checks whether Set1 is a subset of Set2
 bool isSubset(set<Hyperedge *> *Set1, set<Hyperedge *> *Set2);
 
+// Returns the microseconds elapsed since a given point in time
+long long microsecondsSince(chrono::steady_clock::time_point Start);
+
+// Writes a string as JSON string literal
+string toJSON(const string &Text);
+
+// Returns the peak resident set size of the process in kilobytes (0 if unknown)
+long long getPeakRSS();
+
+// Returns the current resident set size of the process in kilobytes (peak size if unknown)
+long long getCurrentRSS();
+
+// Initializes the random number generator of the calling thread
+void random_init(unsigned int iSeed);
+
+// Returns a random integer between 0 and RANDOM_MAX from the generator of the calling thread
+int random_next();
+
 // Returns a random integer between iLB and iUB
 int random_range(int iLB, int iUB);
 
@@ -5,16 +5,16 @@
 #include <cstdlib>
 #include <ctime>
 #include <algorithm>
+#include <vector>
 
 
 #include "Hypergraph.h"
 #include "Parser.h"
+#include "SymbolTable.h"
 #include "Hyperedge.h"
 #include "Node.h"
 #include "Globals.h"
-
-int G_NodeID = 0;
-int G_EdgeID = 0;
+#include "MemoryAccount.h"
 
 
 //////////////////////////////////////////////////////////////////////
@@ -28,6 +28,9 @@ Hypergraph::Hypergraph()
 	iMyMaxNbrOfNodes = 0;
 	MyEdges = NULL;
 	MyNodes = NULL;
+	MySymbols = NULL;
+	cMyNames = NULL;
+	lMyBytes = 0;
 }
 
 
@@ -42,6 +45,10 @@ Hypergraph::~Hypergraph()
 
 	delete [] MyEdges;
 	delete [] MyNodes;
+	delete MySymbols;
+	delete [] cMyNames;
+
+	MemoryAccount::sub(MEM_HYPERGRAPH, lMyBytes);
 }
 
 
@@ -61,32 +68,128 @@ void Hypergraph::labelReachEdges(Hyperedge *Edge)
 }
 
 
+// Computes for each item the sorted list of other items sharing an element with it, where Start/Elems
+// list the elements of the items and InvStart/InvElems the items of the elements (both in CSR form)
+static void collectNeighbours(int iNbrOfItems, const int *Start, const int *Elems, const int *InvStart, const int *InvElems, int *NbrStart, vector<int> *Nbrs)
+{
+	int i, j, k, l, *Marks;
+
+	if((Marks = new int[iNbrOfItems]) == NULL)
+		writeErrorMsg("Error assigning memory.", "collectNeighbours");
+	for(i=0; i < iNbrOfItems; i++)
+		Marks[i] = -1;
+
+	for(i=0; i < iNbrOfItems; i++) {
+		NbrStart[i] = (int)Nbrs->size();
+		// Collect each item reachable over a common element once
+		for(k=Start[i]; k < Start[i+1]; k++)
+			for(l=InvStart[Elems[k]]; l < InvStart[Elems[k]+1]; l++) {
+				j = InvElems[l];
+				if((j != i) && (Marks[j] != i)) {
+					Marks[j] = i;
+					Nbrs->push_back(j);
+				}
+			}
+		// The items are often collected in ascending order already
+		if(!is_sorted(Nbrs->begin()+NbrStart[i], Nbrs->end()))
+			sort(Nbrs->begin()+NbrStart[i], Nbrs->end());
+	}
+	NbrStart[iNbrOfItems] = (int)Nbrs->size();
+
+	delete [] Marks;
+}
+
+
 void Hypergraph::buildHypergraph(Parser *P)
+{
+	int i, iNbrOfAtoms, iNbrOfVars, *AtomVarStart;
+	char **AtomNames, **VarNames;
+
+	iNbrOfAtoms = P->getNbrOfAtoms();
+	iNbrOfVars = P->getNbrOfVars();
+
+	AtomVarStart = new int[iNbrOfAtoms+1];
+	AtomNames = new char*[iNbrOfAtoms];
+	VarNames = new char*[iNbrOfVars];
+	if((AtomVarStart == NULL) || (AtomNames == NULL) || (VarNames == NULL))
+		writeErrorMsg("Error assigning memory.", "Hypergraph::buildHypergraph");
+
+	// The parser stores the variables of all atoms consecutively
+	AtomVarStart[0] = 0;
+	for(i=0; i < iNbrOfAtoms; i++) {
+		AtomVarStart[i+1] = AtomVarStart[i] + P->getNbrOfVars(i);
+		AtomNames[i] = P->getAtom(i);
+	}
+	for(i=0; i < iNbrOfVars; i++)
+		VarNames[i] = P->getVariable(i);
+
+	buildHypergraph(iNbrOfAtoms, iNbrOfVars, AtomVarStart, P->getAtomVars(0), AtomNames, VarNames);
+
+	// Take over the names of the edges and nodes from the parser
+	MySymbols = P->releaseSymbols();
+
+	delete [] AtomVarStart;
+	delete [] AtomNames;
+	delete [] VarNames;
+}
+
+
+void Hypergraph::buildHypergraph(int iNbrOfEdges, int iNbrOfNodes, const int *EdgeNodeStart, const int *EdgeNodes, char **EdgeNames, char **NodeNames)
 {
     int i, j;
+	int *NodeEdgeStart, *NodeEdges, *EdgeNbrStart, *NodeNbrStart;
+	vector<int> EdgeNbrs, NodeNbrs;
 
 	// Allocate arrays with pointers to the edges and nodes of the hypergraph
- 	MyEdges = new Hyperedge*[P->getNbrOfAtoms()];
-	MyNodes = new Node*[P->getNbrOfVars()];
+ 	MyEdges = new Hyperedge*[iNbrOfEdges];
+	MyNodes = new Node*[iNbrOfNodes];
 
 	if((MyEdges == NULL) || (MyNodes == NULL))
 		writeErrorMsg("Error assigning memory.", "Hypergraph::buildHypergraph");
 	else
 	{
-		iMyMaxNbrOfEdges = P->getNbrOfAtoms();
-		iMyMaxNbrOfNodes = P->getNbrOfVars();
+		iMyMaxNbrOfEdges = iNbrOfEdges;
+		iMyMaxNbrOfNodes = iNbrOfNodes;
 	}
+	lMyBytes = (long long)iNbrOfEdges*sizeof(Hyperedge *) + (long long)iNbrOfNodes*sizeof(Node *);
+	MemoryAccount::add(MEM_HYPERGRAPH, lMyBytes);
+
+	// Allocate the incidence and neighbourhood arrays
+	NodeEdgeStart = new int[iMyMaxNbrOfNodes+1];
+	NodeEdges = new int[EdgeNodeStart[iMyMaxNbrOfEdges]];
+	EdgeNbrStart = new int[iMyMaxNbrOfEdges+1];
+	NodeNbrStart = new int[iMyMaxNbrOfNodes+1];
+	if((NodeEdgeStart == NULL) || (NodeEdges == NULL) || (EdgeNbrStart == NULL) || (NodeNbrStart == NULL))
+		writeErrorMsg("Error assigning memory.", "Hypergraph::buildHypergraph");
+
+	// Distribute the edges to their nodes by counting sort such that the edges of each node are sorted
+	for(i=0; i <= iMyMaxNbrOfNodes; i++)
+		NodeEdgeStart[i] = 0;
+	for(i=0; i < EdgeNodeStart[iMyMaxNbrOfEdges]; i++)
+		++NodeEdgeStart[EdgeNodes[i]+1];
+	for(i=0; i < iMyMaxNbrOfNodes; i++)
+		NodeEdgeStart[i+1] += NodeEdgeStart[i];
+	for(i=0; i < iMyMaxNbrOfEdges; i++)
+		for(j=EdgeNodeStart[i]; j < EdgeNodeStart[i+1]; j++)
+			NodeEdges[NodeEdgeStart[EdgeNodes[j]]++] = i;
+	for(i=iMyMaxNbrOfNodes; i > 0; i--)
+		NodeEdgeStart[i] = NodeEdgeStart[i-1];
+	NodeEdgeStart[0] = 0;
 
-	// Create the edges of the hypergraph
+	// Compute the neighbours of the edges and nodes
+	collectNeighbours(iMyMaxNbrOfEdges, EdgeNodeStart, EdgeNodes, NodeEdgeStart, NodeEdges, EdgeNbrStart, &EdgeNbrs);
+	collectNeighbours(iMyMaxNbrOfNodes, NodeEdgeStart, NodeEdges, EdgeNodeStart, EdgeNodes, NodeNbrStart, &NodeNbrs);
+
+	// Create the edges of the hypergraph (the IDs are the positions in this hypergraph)
 	for(i=0; i < iMyMaxNbrOfEdges; i++) {
-		MyEdges[i] = new Hyperedge(G_EdgeID++, P->getAtom(i), P->getNbrOfVars(i), P->getNbrOfAtomNeighbours(i));
+		MyEdges[i] = new Hyperedge(i, EdgeNames[i], EdgeNodeStart[i+1]-EdgeNodeStart[i], EdgeNbrStart[i+1]-EdgeNbrStart[i]);
 		if(MyEdges[i] == NULL)
 			writeErrorMsg("Error assigning memory.", "Hypergraph::buildHypergraph");
 	}
 
-	// Create the nodes of the hypergraph
+	// Create the nodes of the hypergraph (the IDs are the positions in this hypergraph)
 	for(i=0; i < iMyMaxNbrOfNodes; i++) {
-		MyNodes[i] = new Node(G_NodeID++, P->getVariable(i), P->getNbrOfAtoms(i), P->getNbrOfVarNeighbours(i));
+		MyNodes[i] = new Node(i, NodeNames[i], NodeEdgeStart[i+1]-NodeEdgeStart[i], NodeNbrStart[i+1]-NodeNbrStart[i]);
 		if(MyNodes[i] == NULL)
 			writeErrorMsg("Error assigning memory.", "Hypergraph::buildHypergraph");
 	}
@@ -94,22 +197,34 @@ void Hypergraph::buildHypergraph(Parser *P)
 	// Set the pointers of the edges of the hypergraph
 	for(i=0; i < iMyMaxNbrOfEdges; i++) {
 		// Set the pointers of the actual edge to the nodes it contains
-		for(j=0; j < P->getNbrOfVars(i); j++)
-			MyEdges[i]->insNode(MyNodes[P->getNextAtomVar()], j);
+		for(j=EdgeNodeStart[i]; j < EdgeNodeStart[i+1]; j++)
+			MyEdges[i]->insNode(MyNodes[EdgeNodes[j]], j-EdgeNodeStart[i]);
 		// Set the pointers of the actual edge to its neighbours, i.e., edges that have common nodes
-		for(j=0; j < P->getNbrOfAtomNeighbours(i); j++)
-			MyEdges[i]->insNeighbour(MyEdges[P->getNextAtomNeighbour()], j);
+		for(j=EdgeNbrStart[i]; j < EdgeNbrStart[i+1]; j++)
+			MyEdges[i]->insNeighbour(MyEdges[EdgeNbrs[j]], j-EdgeNbrStart[i]);
 	}
 
 	// Set the pointers of the nodes of the hypergraph
 	for(i=0; i < iMyMaxNbrOfNodes; i++) {
 		// Set the pointers of the actual node to the edges in which it is cointained
-		for(j=0; j < P->getNbrOfAtoms(i); j++)
-			MyNodes[i]->insEdge(MyEdges[P->getNextVarAtom()], j);
+		for(j=NodeEdgeStart[i]; j < NodeEdgeStart[i+1]; j++)
+			MyNodes[i]->insEdge(MyEdges[NodeEdges[j]], j-NodeEdgeStart[i]);
 		// Set the pointers of the actual node to its neighbours, i.e., nodes that have common edges
-		for(j=0; j < P->getNbrOfVarNeighbours(i); j++)
-			MyNodes[i]->insNeighbour(MyNodes[P->getNextVarNeighbour()], j);
+		for(j=NodeNbrStart[i]; j < NodeNbrStart[i+1]; j++)
+			MyNodes[i]->insNeighbour(MyNodes[NodeNbrs[j]], j-NodeNbrStart[i]);
 	}
+
+	delete [] NodeEdgeStart;
+	delete [] NodeEdges;
+	delete [] EdgeNbrStart;
+	delete [] NodeNbrStart;
+}
+
+
+void Hypergraph::setNameBlock(char *cNames)
+{
+	delete [] cMyNames;
+	cMyNames = cNames;
 }
 
 
@@ -259,7 +374,9 @@ void Hypergraph::reduce(bool bFinalOnly)
 					for(k=j; k < iMyMaxNbrOfEdges; k++)
 						MyEdges[k] = MyEdges[k+1];
 					MyEdges[iMyMaxNbrOfEdges] = NULL;
-					if(j < i) --i; --j;
+					if(j < i)
+						--i;
+					--j;
 				}
 			}
 		
@@ -8,6 +8,7 @@
 
 
 class Parser;
+class SymbolTable;
 class Hyperedge;
 class Node;
 class Hypertree;
@@ -27,6 +28,15 @@ private:
 	// Array of pointers to the nodes contained in the hypergraph
 	Node **MyNodes;
 
+	// Symbol table storing the names of the edges and nodes
+	SymbolTable *MySymbols;
+
+	// Block storing the names of the edges and nodes if they were not taken over from a parser
+	char *cMyNames;
+
+	// Number of bytes held by the arrays of pointers to the edges and nodes
+	long long lMyBytes;
+
 	// Labels all edges reachable from Edge
 	void labelReachEdges(Hyperedge *Edge);
 
@@ -40,6 +50,13 @@ public:
 	// Read hypergraph from file and construct internal representation
 	void buildHypergraph(Parser *P);
 
+	// Constructs the internal representation from the nodes of the edges given as consecutive 
+	// lists (the nodes of edge i are EdgeNodes[EdgeNodeStart[i]], ..., EdgeNodes[EdgeNodeStart[i+1]-1])
+	void buildHypergraph(int iNbrOfEdges, int iNbrOfNodes, const int *EdgeNodeStart, const int *EdgeNodes, char **EdgeNames, char **NodeNames);
+
+	// Passes a block storing the names of the edges and nodes to the hypergraph
+	void setNameBlock(char *cNames);
+
 	// Returns the number of edges in the hypergraph
 	int getNbrOfEdges();
 
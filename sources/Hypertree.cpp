@@ -6,6 +6,8 @@
 #include <cstdio>
 #include <iostream>
 #include <fstream>
+#include <vector>
+#include <algorithm>
 
 #include "Hypergraph.h"
 #include "Hyperedge.h"
@@ -14,6 +16,9 @@
 #include "Globals.h"
 #include "Hypertree.h"
 #include "SetCover.h"
+#include "FileWriter.h"
+#include "MemoryAccount.h"
+#include "Verifier.h"
 
 
 
@@ -27,6 +32,10 @@ Hypertree::Hypertree()
 	MyParent = NULL;
 	iMyLabel = 0;
 	bMyCut = false;
+	MyCutSep = NULL;
+
+	lMyBytes = 0;
+	account();
 }
 
 
@@ -36,6 +45,8 @@ Hypertree::~Hypertree()
 
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
 		delete *ChildIter;
+
+	MemoryAccount::sub(MEM_HYPERTREE, lMyBytes);
 }
 
 
@@ -45,36 +56,35 @@ Hypertree::~Hypertree()
 //////////////////////////////////////////////////////////////////////
 
 
-void Hypertree::labelCovEdges(Hypergraph *HGraph)
+/*
+***Description***
+The method estimates the number of bytes held by the actual node, i.e., the node itself and the
+entries of its sets and of its list of children, and adds the difference to the last estimate
+to the memory account.
+*/
+
+void Hypertree::account()
 {
-	int i, j;
-	bool bCovered;
-	set<Node *>::iterator NodeIter;
-	list<Hypertree *>::iterator ChildIter;
+	long long lBytes;
 
-	// Label all nodes in the chi-set
-	for(NodeIter=MyChi.begin(); NodeIter != MyChi.end(); NodeIter++)
-		(*NodeIter)->setLabel(1);
+	lBytes = sizeof(Hypertree) + (long long)MyChildren.size()*MEM_LIST_ENTRY(Hypertree *);
+	lBytes += (long long)MyChi.size()*MEM_SET_ENTRY(Node *) + (long long)MyLambda.size()*MEM_SET_ENTRY(Hyperedge *);
+	lBytes += (long long)MyPointers.size()*MEM_SET_ENTRY(void *) + (long long)MyIDs.size()*MEM_SET_ENTRY(int);
 
-	// Label all hyperedges covered by the chi-set
-	for(i=0; i < HGraph->getNbrOfEdges(); i++) {
-		bCovered = true;
-		for(j=0; j < HGraph->getEdge(i)->getNbrOfNodes(); j++)
-			if(HGraph->getEdge(i)->getNode(j)->getLabel() == 0) {
-				bCovered = false;
-				break;
-			}
-		if(bCovered)
-			HGraph->getEdge(i)->setLabel(1);
+	if(lBytes != lMyBytes) {
+		MemoryAccount::add(MEM_HYPERTREE, lBytes-lMyBytes);
+		lMyBytes = lBytes;
 	}
+}
 
-	// Reset node labels in the chi-set
-	for(NodeIter=MyChi.begin(); NodeIter != MyChi.end(); NodeIter++)
-		(*NodeIter)->setLabel(0);
 
-	// Label hyperedges covered by the children
+void Hypertree::accountSubtree()
+{
+	list<Hypertree *>::iterator ChildIter;
+
+	account();
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
-		(*ChildIter)->labelCovEdges(HGraph);
+		(*ChildIter)->accountSubtree();
 }
 
 
@@ -85,11 +95,12 @@ void Hypertree::labelChiSets(int iLabel)
 
 	// Label all nodes in the chi-set
 	for(NodeIter=MyChi.begin(); NodeIter != MyChi.end(); NodeIter++)
-		if((*NodeIter)->getLabel() >= 0)
+		if((*NodeIter)->getLabel() >= 0) {
 			if(((*NodeIter)->getLabel() > 0) && ((*NodeIter)->getLabel() < iLabel))
 				(*NodeIter)->setLabel(-1);
 			else
 				(*NodeIter)->setLabel(iLabel);
+		}
 
 	// Label all nodes in the chi-sets of the children
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
@@ -137,6 +148,7 @@ void Hypertree::setChi_Conn(Hypergraph *HGraph)
 	for(i=0; i < HGraph->getNbrOfNodes(); i++)
 		if(HGraph->getNode(i)->getLabel() == -1)
 			MyChi.insert(HGraph->getNode(i));
+	account();
 	
 	// Set the chi-sets for all children
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
@@ -154,70 +166,13 @@ bool Hypertree::isCyclic_pvt()
 
 	// Check cyclicity for all children
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
-		if((*ChildIter)->isCyclic())
+		if((*ChildIter)->isCyclic_pvt())
 			return true;
 
 	return false;
 }
 
 
-Node *Hypertree::checkCond2()
-{
-	Node *Witness;
-	set<Node *>::iterator NodeIter1, NodeIter2;
-	list<Hypertree *>::iterator ChildIter;
-
-	// Check "connectedness" for each child and label forbidden nodes
-	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++) {
-		if((Witness = (*ChildIter)->checkCond2()) != NULL)
-			return Witness;
-		for(NodeIter1=(*ChildIter)->MyChi.begin(); NodeIter1 != (*ChildIter)->MyChi.end(); NodeIter1++) {
-			NodeIter2 = MyChi.find(*NodeIter1);
-			if(NodeIter2 == MyChi.end())
-				(*NodeIter1)->setLabel(1);
-		}
-	}
-
-	// Check whether there occur forbidden nodes in the actual chi-set
-	for(NodeIter1=MyChi.begin(); NodeIter1 != MyChi.end(); NodeIter1++)
-		if((*NodeIter1)->getLabel() != 0)
-			return *NodeIter1;
-
-	return NULL;
-}
-
-
-Hypertree *Hypertree::checkCond3()
-{
-	set<Hyperedge *>::iterator EdgeIter;
-	set<Node *>::iterator NodeIter;
-	list<Hypertree *>::iterator ChildIter;
-	Hypertree *Witness;
-
-	// Label all variables of hyperedges in the lambda-set
-	for(EdgeIter=MyLambda.begin(); EdgeIter != MyLambda.end(); EdgeIter++)
-		for(int i=0; i < (*EdgeIter)->getNbrOfNodes(); i++)
-			(*EdgeIter)->getNode(i)->setLabel(1);
-
-	// Check whether there is some variable in the chi-set that is not labeled
-	for(NodeIter=MyChi.begin(); NodeIter != MyChi.end(); NodeIter++)
-		if((*NodeIter)->getLabel() == 0)
-			return this;
-
-	// Reset all labels of variables of hyperedges in the lambda-set
-	for(EdgeIter=MyLambda.begin(); EdgeIter != MyLambda.end(); EdgeIter++)
-		for(int i=0; i < (*EdgeIter)->getNbrOfNodes(); i++)
-			(*EdgeIter)->getNode(i)->setLabel(0);
-
-	// Check third condition for all children
-	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
-		if((Witness = (*ChildIter)->checkCond3()) != NULL)
-			return Witness;
-
-	return NULL;
-}
-
-
 void Hypertree::reduceLambdaTopDown()
 {
 	int iNbrOfNodes, iNbrOfHEdges, i, j;
@@ -429,88 +384,68 @@ void Hypertree::reduceLambdaBottomUp()
 		Child->iMyLabel = 1;
 		Child = Child->MyParent;
 	}
+
+	accountSubtree();
 }
 
 
-void Hypertree::writeGMLNodes(ofstream &GMLFile)
+void Hypertree::writeGMLNodes(FileWriter &GMLFile, Hypergraph *HGraph, vector<int> *Order)
 {
-	int i, *iOrder;
+	int i;
 	set<Hyperedge *>::iterator LambdaIter;
 	set<Node *>::iterator ChiIter;
 	list<Hypertree *>::iterator ChildIter;
-	Node **Chi;
-	Hyperedge **Lambda;
-
-	Lambda = new Hyperedge*[MyLambda.size()];
-	iOrder = new int[MyLambda.size()];
-	if((Lambda == NULL) || (iOrder == NULL))
-		writeErrorMsg("Error assigning memory.", "Hypertree::writeGMLNodes");
-	// Copy the lambda-set into an array
-	for(i=0, LambdaIter = MyLambda.begin(); LambdaIter != MyLambda.end(); i++, LambdaIter++) {
-		Lambda[i] = *LambdaIter;
-		iOrder[i] = (*LambdaIter)->getLabel();
-	}
-	sortPointers((void **)Lambda, iOrder, 0, (int)MyLambda.size()-1);
 
-	GMLFile << "  node [" << endl;
-	GMLFile << "    id " << iMyLabel << endl;
+	GMLFile << "  node [\n";
+	GMLFile << "    id " << iMyLabel << '\n';
 	GMLFile << "    label \"{";
 
-	// Write lambda-set
-	if(MyLambda.size() > 0)
-		GMLFile << Lambda[0]->getName();
-	for(i=1; i < (int)MyLambda.size(); i++)
-		GMLFile << ", " << Lambda[i]->getName();
-
-	delete [] Lambda;
-	delete [] iOrder;
+	// Write lambda-set ordered by the labels of the edges
+	Order->clear();
+	for(LambdaIter = MyLambda.begin(); LambdaIter != MyLambda.end(); LambdaIter++)
+		Order->push_back((*LambdaIter)->getLabel());
+	sort(Order->begin(), Order->end());
+	for(i=0; i < (int)Order->size(); i++) {
+		if(i > 0)
+			GMLFile << ", ";
+		GMLFile << HGraph->getEdge((*Order)[i])->getName();
+	}
 
 	GMLFile << "}    {";
 
-	Chi = new Node*[MyChi.size()];
-	iOrder = new int[MyChi.size()];
-	if((Chi == NULL) || (iOrder == NULL))
-		writeErrorMsg("Error assigning memory.", "Hypertree::writeGMLNodes");
-	// Copy the chi-set into an array
-	for(i=0, ChiIter = MyChi.begin(); ChiIter != MyChi.end(); i++, ChiIter++) {
-		Chi[i] = *ChiIter;
-		iOrder[i] = (*ChiIter)->getLabel();
+	// Write chi-set ordered by the labels of the nodes
+	Order->clear();
+	for(ChiIter = MyChi.begin(); ChiIter != MyChi.end(); ChiIter++)
+		Order->push_back((*ChiIter)->getLabel());
+	sort(Order->begin(), Order->end());
+	for(i=0; i < (int)Order->size(); i++) {
+		if(i > 0)
+			GMLFile << ", ";
+		GMLFile << HGraph->getNode((*Order)[i])->getName();
 	}
-	sortPointers((void **)Chi, iOrder, 0, (int)MyChi.size()-1);
-
-	// Write chi-set
-	if(MyChi.size() > 0)
-		GMLFile << Chi[0]->getName();
-	for(i=1; i < (int)MyChi.size(); i++)
-		GMLFile << ", " << Chi[i]->getName();
-
-	delete [] Chi;
-	delete [] iOrder;
 	
-	GMLFile << "}\"" << endl;
-	GMLFile << "    vgj [" << endl;
-	GMLFile << "      labelPosition \"in\"" << endl;
-	GMLFile << "      shape \"Rectangle\"" << endl;
-	GMLFile << "    ]" << endl;
-	GMLFile << "  ]" << endl << endl;
+	GMLFile << "}\"\n";
+	GMLFile << "    vgj [\n";
+	GMLFile << "      labelPosition \"in\"\n";
+	GMLFile << "      shape \"Rectangle\"\n";
+	GMLFile << "    ]\n";
+	GMLFile << "  ]\n\n";
 
 	// Write GML nodes for all subtrees
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
-		(*ChildIter)->writeGMLNodes(GMLFile);
+		(*ChildIter)->writeGMLNodes(GMLFile, HGraph, Order);
 }
 
 
-void Hypertree::writeGMLEdges(ofstream &GMLFile)
+void Hypertree::writeGMLEdges(FileWriter &GMLFile)
 {
-	set<Hyperedge *>::iterator LambdaIter;
-	set<Node *>::iterator ChiIter;
 	list<Hypertree *>::iterator ChildIter;
 
 	if(MyParent != NULL) {
-		GMLFile << "  edge [" << endl;
-		GMLFile << "    source " << MyParent->getLabel() << endl;
-		GMLFile << "    target " << iMyLabel << endl;
-		GMLFile << "  ]" << endl << endl;
+		GMLFile << "  edge [\n";
+		GMLFile << "    source " << MyParent->getLabel() << '\n';
+		GMLFile << "    target " << iMyLabel << '\n';
+		GMLFile << "  ]\n\n";
 	}
 
 	// Write GML edges for all subtrees
@@ -519,10 +454,77 @@ void Hypertree::writeGMLEdges(ofstream &GMLFile)
 }
 
 
+void Hypertree::writePACEBags(FileWriter &PACEFile, vector<int> *Order)
+{
+	int i;
+	set<Node *>::iterator ChiIter;
+	list<Hypertree *>::iterator ChildIter;
+
+	// Write chi-set ordered by the labels of the nodes
+	Order->clear();
+	for(ChiIter = MyChi.begin(); ChiIter != MyChi.end(); ChiIter++)
+		Order->push_back((*ChiIter)->getLabel());
+	sort(Order->begin(), Order->end());
+	PACEFile << "b " << iMyLabel;
+	for(i=0; i < (int)Order->size(); i++)
+		PACEFile << ' ' << (*Order)[i]+1;
+	PACEFile << '\n';
+
+	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
+		(*ChildIter)->writePACEBags(PACEFile, Order);
+}
+
+
+void Hypertree::writePACEEdges(FileWriter &PACEFile)
+{
+	list<Hypertree *>::iterator ChildIter;
+
+	if(MyParent != NULL)
+		PACEFile << MyParent->getLabel() << ' ' << iMyLabel << '\n';
+
+	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
+		(*ChildIter)->writePACEEdges(PACEFile);
+}
+
+
+void Hypertree::writePACEWeights(FileWriter &PACEFile, vector<int> *Order)
+{
+	int i;
+	set<Hyperedge *>::iterator LambdaIter;
+	list<Hypertree *>::iterator ChildIter;
+
+	// Write lambda-set ordered by the labels of the edges
+	Order->clear();
+	for(LambdaIter = MyLambda.begin(); LambdaIter != MyLambda.end(); LambdaIter++)
+		Order->push_back((*LambdaIter)->getLabel());
+	sort(Order->begin(), Order->end());
+	for(i=0; i < (int)Order->size(); i++)
+		PACEFile << "w " << iMyLabel << ' ' << (*Order)[i]+1 << " 1\n";
+
+	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
+		(*ChildIter)->writePACEWeights(PACEFile, Order);
+}
+
+
 void Hypertree::outputToGML(Hypergraph *HGraph, char *cNameOfFile)
+{
+	FileWriter GMLFile;
+
+	// Check if file opening was successful
+	if(!GMLFile.open(cNameOfFile))
+		writeErrorMsg("Error opening file.", "Hypertree::outputToGML");
+
+	writeGML(GMLFile, HGraph);
+
+	if(!GMLFile.close())
+		writeErrorMsg("Error writing file.", "Hypertree::outputToGML");
+}
+
+
+void Hypertree::writeGML(FileWriter &GMLFile, Hypergraph *HGraph)
 {
 	int i;
-	ofstream GMLFile;
+	vector<int> Order;
 	
 	// Set labels to write the output in a uniform order
 	setIDLabels();
@@ -531,33 +533,75 @@ void Hypertree::outputToGML(Hypergraph *HGraph, char *cNameOfFile)
 	for(i=0; i < HGraph->getNbrOfEdges(); i++)
 		HGraph->getEdge(i)->setLabel(i);
 
-	GMLFile.open(cNameOfFile, ios::out);
+	GMLFile << "graph [\n\n";
+	GMLFile << "  directed 0\n\n";
+
+	writeGMLNodes(GMLFile, HGraph, &Order);  // Write hypertree nodes in GML format
+	writeGMLEdges(GMLFile);  // Write hypertree edges in GML format
+
+	GMLFile << "]\n";
+}
+
+
+/*
+***Description***
+The method writes the hypertree in the PACE 2019 format for hypertree decompositions: a solution
+line "s htd <bags> <width> <nodes> <edges>", a line "b <bag> <nodes>" for each hypertree node 
+with its chi-set, a line "<bag> <bag>" for each hypertree edge, and a line "w <bag> <edge> 1" 
+for each edge in the lambda-set of a hypertree node. Bags, nodes, and edges are numbered from 1
+in the order of a depth-first traversal of the hypertree and by their positions in the hypergraph,
+respectively.
+
+INPUT:	HGraph: Hypergraph decomposed by the hypertree
+		cNameOfFile: Name of the output file
+OUTPUT: -
+*/
+
+void Hypertree::outputToPACE(Hypergraph *HGraph, char *cNameOfFile)
+{
+	FileWriter PACEFile;
 
 	// Check if file opening was successful
-	if(!GMLFile.is_open())
-		writeErrorMsg("Error opening file.", "Hypertree::outputToGML");
+	if(!PACEFile.open(cNameOfFile))
+		writeErrorMsg("Error opening file.", "Hypertree::outputToPACE");
 
-	GMLFile << "graph [" << endl << endl;
-	GMLFile << "  directed 0" << endl << endl;
+	writePACE(PACEFile, HGraph);
 
-	writeGMLNodes(GMLFile);  // Write hypertree nodes in GML format
-	writeGMLEdges(GMLFile);  // Write hypertree edges in GML format
+	if(!PACEFile.close())
+		writeErrorMsg("Error writing file.", "Hypertree::outputToPACE");
+}
 
-	GMLFile << "]" << endl;
 
-	GMLFile.close();
+void Hypertree::writePACE(FileWriter &PACEFile, Hypergraph *HGraph)
+{
+	int i, iNbrOfBags;
+	vector<int> Order;
+	
+	// Set labels to write the output in a uniform order
+	iNbrOfBags = setIDLabels();
+	for(i=0; i < HGraph->getNbrOfNodes(); i++)
+		HGraph->getNode(i)->setLabel(i);
+	for(i=0; i < HGraph->getNbrOfEdges(); i++)
+		HGraph->getEdge(i)->setLabel(i);
+
+	PACEFile << "s htd " << iNbrOfBags << ' ' << getHTreeWidth() << ' ' << HGraph->getNbrOfNodes() << ' ' << HGraph->getNbrOfEdges() << '\n';
+	writePACEBags(PACEFile, &Order);
+	writePACEEdges(PACEFile);
+	writePACEWeights(PACEFile, &Order);
 }
 
 
 void Hypertree::insChi(Node *Node)
 {
 	MyChi.insert(Node);
+	account();
 }
 
 
 void Hypertree::insLambda(Hyperedge *Edge)
 {
 	MyLambda.insert(Edge);
+	account();
 }
 
 
@@ -578,6 +622,7 @@ void Hypertree::insChild(Hypertree *Child, bool bSetParent)
 	MyChildren.push_back(Child);
 	if(bSetParent)
 		Child->setParent(this);
+	account();
 }
 
 
@@ -591,6 +636,7 @@ bool Hypertree::remChild(Hypertree *Child)
 	if(ChildIter != MyChildren.end()) {
 		// If the child was found, remove it
 		MyChildren.erase(ChildIter);
+		account();
 		return true;
 	}
 
@@ -605,18 +651,33 @@ void Hypertree::remChildren()
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
 		(*ChildIter)->setParent(NULL);
 	MyChildren.clear();
+	account();
+}
+
+
+list<Hypertree *> *Hypertree::getChildren()
+{
+	return &MyChildren;
 }
 
 
 void Hypertree::insPointer(void *Ptr)
 {
 	MyPointers.insert(Ptr);
+	account();
+}
+
+
+set<void *> *Hypertree::getPointers()
+{
+	return &MyPointers;
 }
 
 
 void Hypertree::insID(int iID)
 {
 	MyIDs.insert(iID);
+	account();
 }
 
 
@@ -632,6 +693,18 @@ bool Hypertree::isCut()
 }
 
 
+void Hypertree::setCutSeparator(Hyperedge **Separator)
+{
+	MyCutSep = Separator;
+}
+
+
+Hyperedge **Hypertree::getCutSeparator()
+{
+	return MyCutSep;
+}
+
+
 Hypertree *Hypertree::getCutNode()
 {
 	Hypertree *HTree = NULL;
@@ -649,6 +722,21 @@ Hypertree *Hypertree::getCutNode()
 }
 
 
+void Hypertree::getCutNodes(list<Hypertree *> *CutNodes)
+{
+	list<Hypertree *>::iterator ChildIter;
+
+	if(bMyCut) {
+		CutNodes->push_back(this);
+		return;
+	}
+
+	// Collect cut nodes in the subtrees rooted at the child nodes
+	for(ChildIter = MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
+		(*ChildIter)->getCutNodes(CutNodes);
+}
+
+
 Hypertree *Hypertree::getHTNode(void *Ptr)
 {
 	Hypertree *HTree = NULL;
@@ -941,6 +1029,7 @@ void Hypertree::elimCovEdges()
 	delete Nodes;
 	delete HEdges;
 	delete CovEdges;
+	account();
 
 	// Eliminate covered hyperedges in all subtrees
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
@@ -952,6 +1041,7 @@ void Hypertree::reduceLambda()
 {
 	reduceLambdaTopDown();
 	reduceLambdaBottomUp();
+	accountSubtree();
 }
 
 
@@ -1037,6 +1127,7 @@ void Hypertree::setLambda(Hypergraph *HGraph)
 	delete Nodes;
 	delete HEdges;
 	delete CovEdges1;
+	account();
 
 	// Set the lambda-sets for all subtrees
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
@@ -1078,6 +1169,7 @@ void Hypertree::resetLambda(Hypergraph *HGraph)
 	delete Nodes;
 	delete HEdges;
 	delete CovEdges;
+	account();
 
 	// Set the lambda-sets for all subtrees
 	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
@@ -1087,67 +1179,40 @@ void Hypertree::resetLambda(Hypergraph *HGraph)
 
 Hyperedge *Hypertree::checkCond1(Hypergraph *HGraph)
 {
-	HGraph->resetEdgeLabels();
-	HGraph->resetNodeLabels();
-
-	// Label all hyperedges covered by some chi-set
-	labelCovEdges(HGraph);
+	Verifier V;
 
-	// Search for hyperedges that are not labeled
-	for(int i=0; i < HGraph->getNbrOfEdges(); i++)
-		if(HGraph->getEdge(i)->getLabel() == 0)
-			return HGraph->getEdge(i);
-
-	return NULL;
+	V.index(HGraph, this);
+	return V.checkCond1();
 }
 
 
 Node *Hypertree::checkCond2(Hypergraph *HGraph)
 {
-	HGraph->resetNodeLabels();
-	return checkCond2();
+	Verifier V;
+
+	V.index(HGraph, this);
+	return V.checkCond2();
 }
 
 
 Hypertree *Hypertree::checkCond3(Hypergraph *HGraph)
 {
-	HGraph->resetNodeLabels();
-	return checkCond3();
+	int t;
+	Verifier V;
+
+	V.index(HGraph, this);
+	t = V.checkCond3();
+	return t < 0 ? NULL : V.getTNode(t);
 }
 
 
 Hypertree *Hypertree::checkCond4(Hypergraph *HGraph)
 {
-	int i;
-	set<Hyperedge *>::iterator EdgeIter;
-	set<Node *>::iterator NodeIter;
-	list<Hypertree *>::iterator ChildIter;
-	Hypertree *Witness;
+	int t;
+	Verifier V;
 
-	// Label all variables occurring in some chi-set of the subtree
-	HGraph->resetNodeLabels();
-	labelChiSets();
-
-	// Compute the intersection with the variables of hyperedges in the lambda-set
-	for(EdgeIter=MyLambda.begin(); EdgeIter != MyLambda.end(); EdgeIter++)
-		for(i=0; i < (*EdgeIter)->getNbrOfNodes(); i++)
-			if((*EdgeIter)->getNode(i)->getLabel() != 0)
-				(*EdgeIter)->getNode(i)->setLabel(2);
-
-	// Compute the set difference between the intersection and the chi-set
-	for(NodeIter=MyChi.begin(); NodeIter != MyChi.end(); NodeIter++)
-		(*NodeIter)->decLabel();
-	
-	// Check whether the set difference is empty
-	for(i=0; i < HGraph->getNbrOfNodes(); i++)
-		if(HGraph->getNode(i)->getLabel() > 1)
-			return this;
-
-	// Check fourth condition for all children
-	for(ChildIter=MyChildren.begin(); ChildIter != MyChildren.end(); ChildIter++)
-		if((Witness = (*ChildIter)->checkCond4(HGraph)) != NULL)
-			return Witness;
-
-	return NULL;
+	V.index(HGraph, this);
+	t = V.checkCond4();
+	return t < 0 ? NULL : V.getTNode(t);
 }
 
@@ -9,10 +9,12 @@
 
 #include <list>
 #include <set>
+#include <vector>
 
 using namespace std;
 
 class Hypergraph;
+class FileWriter;
 class Hyperedge;
 class Node;
 
@@ -43,8 +45,17 @@ private:
 	// Indicates whether the actual hypertree-branch was cut
 	bool bMyCut;
 
-	// Labels all hyperedges covered by the chi-set of some node
-	void labelCovEdges(Hypergraph *HGraph);
+	// Separator of the decomp call that cut the hypertree-branch (NULL if unknown)
+	Hyperedge **MyCutSep;
+
+	// Number of bytes of the node and its sets added to the memory account
+	long long lMyBytes;
+
+	// Updates the memory account by the bytes of the node and its sets
+	void account();
+
+	// Updates the memory account of all nodes in the subtree
+	void accountSubtree();
 
 	// Labels the variables in the chi-sets of all nodes
 	void labelChiSets(int iLabel = 1);
@@ -58,12 +69,6 @@ private:
 	// The method checks whether the hypertree contains cycles
 	bool isCyclic_pvt();
 
-	// Checks condition 2
-	Node *checkCond2();
-
-	// Checks condition 3
-	Hypertree *checkCond3();
-
 	// Reduces the labellings in the lambda-sets
 	void reduceLambdaTopDown();
 
@@ -71,10 +76,19 @@ private:
 	void reduceLambdaBottomUp();
 
 	// Writes hypertree nodes into a GML file
-	void writeGMLNodes(ofstream &GMLFile);
+	void writeGMLNodes(FileWriter &GMLFile, Hypergraph *HGraph, vector<int> *Order);
 
 	// Writes hypertree edges into a GML file
-	void writeGMLEdges(ofstream &GMLFile);
+	void writeGMLEdges(FileWriter &GMLFile);
+
+	// Writes the bags (chi-sets) of the hypertree nodes into a PACE file
+	void writePACEBags(FileWriter &PACEFile, vector<int> *Order);
+
+	// Writes hypertree edges into a PACE file
+	void writePACEEdges(FileWriter &PACEFile);
+
+	// Writes the lambda-sets of the hypertree nodes as weights into a PACE file
+	void writePACEWeights(FileWriter &PACEFile, vector<int> *Order);
 
 public:
 	// Constructor
@@ -85,6 +99,15 @@ public:
 
 	// Writes hypertree to GML format file
 	void outputToGML(Hypergraph *HGraph, char *cNameOfFile);
+
+	// Writes hypertree to PACE format file (.htd or .ghd)
+	void outputToPACE(Hypergraph *HGraph, char *cNameOfFile);
+
+	// Writes the hypertree in GML format into an open writer
+	void writeGML(FileWriter &GMLFile, Hypergraph *HGraph);
+
+	// Writes the hypertree in PACE format into an open writer
+	void writePACE(FileWriter &PACEFile, Hypergraph *HGraph);
     
 	// Inserts a node into the chi-set 
 	void insChi(Node *Node);
@@ -106,11 +129,17 @@ public:
 
 	// Removes all pointers to children
 	void remChildren();
+
+	// Returns the list of children
+	list<Hypertree *> *getChildren();
 	
 	// Inserts a pointer into the pointer set;
 	// these pointers can be used for the construction of hypertrees
 	void insPointer(void *Ptr);
 
+	// Returns the pointer set
+	set<void *> *getPointers();
+
 	// Inserts an ID into the ID set;
 	// these IDs can be used for the construction of hypertrees
 	void insID(int iID);
@@ -121,10 +150,20 @@ public:
 	// Returns true if the actual hypertree-node was cut; otherwise false
 	bool isCut();
 
+	// Sets the separator of the decomp call that cut the hypertree-branch
+	void setCutSeparator(Hyperedge **Separator);
+
+	// Returns the separator of the decomp call that cut the hypertree-branch (NULL if unknown)
+	Hyperedge **getCutSeparator();
+
 	// Returns a cut tree node within the subtree rooted at
 	// the actual tree node
 	Hypertree *getCutNode();
 
+	// Collects all cut tree nodes within the subtree rooted at
+	// the actual tree node
+	void getCutNodes(list<Hypertree *> *CutNodes);
+
 	// Returns the tree node within the subtree rooted at the 
 	// actual tree node, whose pointer list contains Ptr
 	Hypertree *getHTNode(void *Ptr);
@@ -17,123 +17,314 @@
 #include <cstdlib>
 #include <cstdio>
 #include <iostream>
+#include <fstream>
 #include <ctime>
 #include <list>
 #include <cstring>
+#include <csignal>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <thread>
 
 using namespace std;
 
 #include "Parser.h"
 #include "Hypergraph.h"
 #include "Hypertree.h"
+#include "FlatHypertree.h"
 #include "Component.h"
 #include "Node.h"
 #include "Hyperedge.h"
 #include "Globals.h"
 #include "DetKDecomp.h"
+#include "BucketElim.h"
+#include "BinaryFormat.h"
+#include "PACEFormat.h"
+#include "Batch.h"
+#include "Server.h"
+#include "Client.h"
+#include "MappedFile.h"
+#include "FileWriter.h"
+#include "SearchProfile.h"
+#include "MemoryAccount.h"
+#include "TraceWriter.h"
+#include "Verifier.h"
 
 void usage(int, char **, int *, bool *);
-Hypertree *decompK(Hypergraph *, int);
-bool verify(Hypergraph *, Hypertree *);
+int parseWidth(char *);
+int convert(int, char **);
+int client(int, char **);
+void loadHypergraph(Hypergraph *, const char *, bool);
+void stopSearch(int);
+FlatHypertree *flatten(Hypergraph *, Hypertree *);
+FlatHypertree *decompK(Hypergraph *, int, bool *);
+FlatHypertree *decompHeuristic(Hypergraph *);
+bool verify(Hypergraph *, FlatHypertree *);
+string formatSeconds(long long);
+void writeStats(Hypergraph *, int, FlatHypertree *, bool, bool);
 
 
-char *cInpFile, *cOutFile;
+char *cInpFile, *cOutFile, *cCheckpointFile = NULL, *cResumeFile = NULL, *cBatchFile = NULL, *cServerFile = NULL, *cStatsFile = NULL, *cProgressFile = NULL, *cTraceFile = NULL;
+char *cRecordFile = NULL, *cReplayFile = NULL;
+int iCheckpointInterval = 300, iTimeLimit = 0, iNbrOfThreads = 1, iProgressInterval = 0, iTraceDepth = -1;
+long long lTraceLimit = 1000000;
+bool bPACE = false, bProfile = false, bSeed = false;
+
+// Seed of the random number generator (the current time unless given by --seed)
+unsigned int iSeed = 0;
+
+// Times in microseconds of the phases of a run and search statistics (written by --stats-json)
+long long lParseTime = 0, lBuildTime = 0, lOrderTime = 0, lSearchTime = 0, lExpandTime = 0, lShrinkTime = 0;
+long long lHeuristicTime = 0, lVerifyTime = 0, lOutputTime = 0;
+long long lNbrOfCalls = 0, lNbrOfSeps = 0, lNbrOfCutParts = 0;
+chrono::steady_clock::time_point ProgramStart;
+
+// Counters of the search per recursion level (written if --profile is given)
+SearchProfile Profile;
 
 
 
 int main(int argc, char **argv)
 {
-	int iRandomInit, K=0;
-	bool bDef;
-	time_t start, end;
+	int K=0;
+	bool bDef, bStopped, bVerified = false;
+	chrono::steady_clock::time_point Start;
+	char *cPACEFile;
 	Hypergraph HG;
-	Parser *P;
-	Hypertree *HT;
-	
-	cout << "*** det-k-decomp (version 1.0) ***" << endl << endl;
+	FlatHypertree *HT;
+	Batch *B;
+	Server *S;
+
+	// Convert the input file into binary format
+	if((argc > 1) && (strcmp(argv[1], "convert") == 0)) {
+		cout << "*** det-k-decomp (version 1.0) ***" << endl << endl;
+		return convert(argc, argv);
+	}
+
+	// Send a request to a running server
+	if((argc > 1) && (strcmp(argv[1], "client") == 0))
+		return client(argc, argv);
 
-	// Check command line arguments and initialize random number generator
+	// Check command line arguments
+	ProgramStart = chrono::steady_clock::now();
 	usage(argc, argv, &K, &bDef);
-	srand((unsigned int)time(NULL));
-	iRandomInit = random_range(999, 9999);
-	for(int i=0; i < iRandomInit; i++) rand();
-	
-	// Create parser object
-	if((P = new Parser(bDef)) == NULL)
-		writeErrorMsg("Error assigning memory.", "main");
+	if(!bSeed)
+		iSeed = (unsigned int)time(NULL);
+
+	// Process the instances of a batch on worker threads and write one JSON line per instance
+	if(cBatchFile != NULL) {
+		signal(SIGTERM, stopSearch);
+		signal(SIGINT, stopSearch);
+		if((B = new Batch(K, bDef, bPACE, iTimeLimit, iSeed)) == NULL)
+			writeErrorMsg("Error assigning memory.", "main");
+		B->readList(cBatchFile);
+		B->run(iNbrOfThreads);
+		delete B;
+		return EXIT_SUCCESS;
+	}
 
-	// Parse file
-	cout << "Parsing input file \"" << cInpFile << "\" ... " << endl;
-	time(&start);
-	P->parseFile(cInpFile);
-	time(&end);
-	cout << "Parsing input file done in " << difftime(end, start) << " sec";
-	cout << " (" << P->getNbrOfAtoms() << " atoms, " << P->getNbrOfVars() << " variables)." << endl << endl;
-	
-	// Build hypergraph
-	cout << "Building hypergraph ... " << endl;
-	time(&start);
-	HG.buildHypergraph(P);
-	if(!HG.isConnected())
-		cerr << "Warning: Hypergraph is not connected." << endl;
-	time(&end);
-	cout << "Building hypergraph done in " << difftime(end, start) << " sec." << endl << endl;
-	delete P;
+	// Answer requests over a Unix domain socket until SIGTERM or SIGINT is received
+	if(cServerFile != NULL) {
+		signal(SIGTERM, stopSearch);
+		signal(SIGINT, stopSearch);
+		if((S = new Server(SRV_MAX_PENDING, iSeed)) == NULL)
+			writeErrorMsg("Error assigning memory.", "main");
+		cout << "*** det-k-decomp (version 1.0) ***" << endl << endl;
+		cout << "Listening on \"" << cServerFile << "\" with " << iNbrOfThreads << " worker(s) ..." << endl;
+		S->run(cServerFile, iNbrOfThreads);
+		cout << "Server stopped." << endl;
+		delete S;
+		return EXIT_SUCCESS;
+	}
+
+	cout << "*** det-k-decomp (version 1.0) ***" << endl << endl;
+
+	// Initialize random number generator; the seed is reported such that the run can be repeated
+	random_init(iSeed);
+	cout << "Random seed: " << iSeed << endl << endl;
+
+	loadHypergraph(&HG, cInpFile, bDef);
 
-	HT = decompK(&HG, K);
+	// Stop the search cooperatively on SIGTERM and SIGINT
+	signal(SIGTERM, stopSearch);
+	signal(SIGINT, stopSearch);
+
+	HT = decompK(&HG, K, &bStopped);
+
+	// Fall back to a heuristic decomposition if the search was stopped
+	if(bStopped)
+		HT = decompHeuristic(&HG);
 
 	// Check hypertree conditions
 	if(HT != NULL)
 	{
 		cout << "Checking hypertree conditions ... " << endl;
-		time(&start);
-		verify(&HG, HT);
-		time(&end);
-		cout << "Checking hypertree conditions done in " << difftime(end, start) << " sec." << endl << endl;
+		Start = chrono::steady_clock::now();
+		bVerified = verify(&HG, HT);
+		lVerifyTime = microsecondsSince(Start);
+		cout << "Checking hypertree conditions done in " << formatSeconds(lVerifyTime) << " sec." << endl << endl;
+		Start = chrono::steady_clock::now();
 		HT->outputToGML(&HG, cOutFile);
 		cout << "GML output written to: " << cOutFile << endl << endl;
-		delete HT;
+
+		// Write a hypertree decomposition (.htd) or a generalized one (.ghd) in PACE format
+		if(bPACE) {
+			cPACEFile = new char[strlen(cOutFile)+1];
+			if(cPACEFile == NULL)
+				writeErrorMsg("Error assigning memory.", "main");
+			strcpy(cPACEFile, cOutFile);
+			strcpy(cPACEFile+strlen(cPACEFile)-4, bStopped ? ".ghd" : ".htd");
+			HT->outputToPACE(&HG, cPACEFile);
+			cout << "PACE output written to: " << cPACEFile << endl << endl;
+			delete [] cPACEFile;
+		}
+		lOutputTime = microsecondsSince(Start);
 	}
 
+	if(cStatsFile != NULL)
+		writeStats(&HG, K, HT, bStopped, bVerified);
+	delete HT;
+
 	return EXIT_SUCCESS;
 }
 
 
 void usage(int argc, char **argv, int *K, bool *bDef)
 {
-	int i, j, k;
+	int i;
+	char *cEnd;
 	*bDef = false;
 
 	// Check arguments
 	for (i=1; (i < argc) && (argv[i][0] == '-'); i++)
 		if (strcmp(argv[i], "-def") == 0)
 			*bDef = true;
+		else if (strcmp(argv[i], "--pace") == 0)
+			bPACE = true;
+		else if ((strcmp(argv[i], "--checkpoint") == 0) && (i+1 < argc))
+			cCheckpointFile = argv[++i];
+		else if ((strcmp(argv[i], "--checkpoint-every") == 0) && (i+1 < argc)) {
+			iCheckpointInterval = atoi(argv[++i]);
+			if(iCheckpointInterval < 0) {
+				cerr << "Illegal argument --checkpoint-every " << argv[i] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "--resume") == 0) && (i+1 < argc))
+			cResumeFile = argv[++i];
+		else if ((strcmp(argv[i], "--batch") == 0) && (i+1 < argc))
+			cBatchFile = argv[++i];
+		else if ((strcmp(argv[i], "--server") == 0) && (i+1 < argc))
+			cServerFile = argv[++i];
+		else if ((strcmp(argv[i], "-j") == 0) && (i+1 < argc)) {
+			iNbrOfThreads = atoi(argv[++i]);
+			if(iNbrOfThreads < 1) {
+				cerr << "Illegal argument -j " << argv[i] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "--stats-json") == 0) && (i+1 < argc))
+			cStatsFile = argv[++i];
+		else if (strcmp(argv[i], "--profile") == 0)
+			bProfile = true;
+		else if ((strcmp(argv[i], "--progress-interval") == 0) && (i+1 < argc)) {
+			iProgressInterval = atoi(argv[++i]);
+			if(iProgressInterval < 1) {
+				cerr << "Illegal argument --progress-interval " << argv[i] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "--progress-file") == 0) && (i+1 < argc))
+			cProgressFile = argv[++i];
+		else if ((strcmp(argv[i], "--seed") == 0) && (i+1 < argc)) {
+			iSeed = (unsigned int)strtoul(argv[++i], &cEnd, 10);
+			if((argv[i][0] < '0') || (argv[i][0] > '9') || (*cEnd != '\0')) {
+				cerr << "Illegal argument --seed " << argv[i] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+			bSeed = true;
+		}
+		else if ((strcmp(argv[i], "--record") == 0) && (i+1 < argc))
+			cRecordFile = argv[++i];
+		else if ((strcmp(argv[i], "--replay") == 0) && (i+1 < argc))
+			cReplayFile = argv[++i];
+		else if ((strcmp(argv[i], "--trace") == 0) && (i+1 < argc))
+			cTraceFile = argv[++i];
+		else if ((strcmp(argv[i], "--trace-limit") == 0) && (i+1 < argc)) {
+			lTraceLimit = atoll(argv[++i]);
+			if(lTraceLimit < 0) {
+				cerr << "Illegal argument --trace-limit " << argv[i] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "--trace-depth") == 0) && (i+1 < argc)) {
+			iTraceDepth = atoi(argv[++i]);
+			if(iTraceDepth < 0) {
+				cerr << "Illegal argument --trace-depth " << argv[i] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if ((strcmp(argv[i], "--time-limit") == 0) && (i+1 < argc)) {
+			iTimeLimit = atoi(argv[++i]);
+			if(iTimeLimit < 0) {
+				cerr << "Illegal argument --time-limit " << argv[i] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
 		else {
 			cerr << "Unknown argument \"" << argv[i] << "\"." << endl;
 			exit(EXIT_FAILURE);
 		}
 
-	if(i < argc-1) {
-		for(j=0; argv[i][j] == '0'; j++);
-		for(k=0; (k < 6) && (argv[i][j+k] != '\0'); k++)
-			if(!((argv[i][j+k] >= '0') && (argv[i][j+k] <= '9')))
-				break;
-		if(argv[i][j+k] == '\0') {
-			*K = atoi(argv[i++]);
-			if(*K < 1) {
-				cerr << "Illegal argument k = 0." << endl;
-				exit(EXIT_FAILURE);
-			}
+	// In server mode, the hypergraphs and k are given by the requests
+	if(cServerFile != NULL) {
+		if((i != argc) || (cBatchFile != NULL) || (cCheckpointFile != NULL) || (cResumeFile != NULL) || (cStatsFile != NULL) || bProfile || (iProgressInterval > 0) || (cProgressFile != NULL) || (cTraceFile != NULL) || (cRecordFile != NULL) || (cReplayFile != NULL)) {
+			cerr << "Usage: " << argv[0] << " --server <socket file> [-j <threads>] [--seed <n>]" << endl;
+			exit(EXIT_FAILURE);
 		}
-		else {
-			cerr << "Illegal argument k = " << argv[i] << "." << endl;
+		return;
+	}
+
+	// In batch mode, k is optional and the instances are given by the list file
+	if(cBatchFile != NULL) {
+		if((cCheckpointFile != NULL) || (cResumeFile != NULL) || (cRecordFile != NULL) || (cReplayFile != NULL)) {
+			cerr << "Checkpoints and records cannot be used in batch mode." << endl;
+			exit(EXIT_FAILURE);
+		}
+		if((cStatsFile != NULL) || bProfile || (iProgressInterval > 0) || (cProgressFile != NULL) || (cTraceFile != NULL)) {
+			cerr << "Statistics files, profiles, progress records, and traces cannot be used in batch mode (see the JSON lines)." << endl;
+			exit(EXIT_FAILURE);
+		}
+		if(i == argc-1)
+			*K = parseWidth(argv[i++]);
+		if(i != argc) {
+			cerr << "Usage: " << argv[0] << " [-def] [--pace] [--time-limit <sec>] [--seed <n>] --batch <list file> [-j <threads>] [<k>]" << endl;
 			exit(EXIT_FAILURE);
 		}
+		return;
 	}
 
+	if(i < argc-1)
+		*K = parseWidth(argv[i++]);
+
 	// Write usage error message
-	if ((!*bDef && (argc < 3)) || (*bDef && (argc < 4))|| (i < argc-1)) {
-		cerr << "Usage: " << argv[0] << " [-def] <k> <filename>" << endl;
+	if ((*K == 0) || (i != argc-1)) {
+		cerr << "Usage: " << argv[0] << " [-def] [--pace] [--checkpoint <file>] [--checkpoint-every <sec>] [--resume <file>] [--time-limit <sec>] [--stats-json <file>] [--profile] [--progress-interval <sec> [--progress-file <file>]]" << endl;
+		cerr << "       " << string(strlen(argv[0]), ' ') << " [--trace <file> [--trace-limit <events>] [--trace-depth <level>]] [--seed <n>] [--record <file>] [--replay <file>] <k> <filename>" << endl;
+		cerr << "       " << argv[0] << " [-def] [--pace] [--time-limit <sec>] [--seed <n>] --batch <list file> [-j <threads>] [<k>]" << endl;
+		cerr << "       " << argv[0] << " --server <socket file> [-j <threads>] [--seed <n>]" << endl;
+		cerr << "       " << argv[0] << " client [-def] [--pace] [--optimize] [--deadline <sec>] <socket file> [<k>] <filename>" << endl;
+		cerr << "       " << argv[0] << " convert [-def] <input file> <output file>" << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	if((cProgressFile != NULL) && (iProgressInterval == 0)) {
+		cerr << "Option --progress-file requires --progress-interval." << endl;
+		exit(EXIT_FAILURE);
+	}
+	if((cReplayFile != NULL) && ((cCheckpointFile != NULL) || (cResumeFile != NULL))) {
+		cerr << "Checkpoints cannot be used when replaying a record." << endl;
 		exit(EXIT_FAILURE);
 	}
 
@@ -155,49 +346,343 @@ void usage(int argc, char **argv, int *K, bool *bDef)
 }
 
 
-Hypertree *decompK(Hypergraph *HG, int iWidth)
+int parseWidth(char *cArg)
+{
+	int j, k, K;
+
+	for(j=0; cArg[j] == '0'; j++);
+	for(k=0; (k < 6) && (cArg[j+k] != '\0'); k++)
+		if(!((cArg[j+k] >= '0') && (cArg[j+k] <= '9')))
+			break;
+	if(cArg[j+k] != '\0') {
+		cerr << "Illegal argument k = " << cArg << "." << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	K = atoi(cArg);
+	if(K < 1) {
+		cerr << "Illegal argument k = 0." << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	return K;
+}
+
+
+int convert(int argc, char **argv)
 {
-	time_t start, end;
+	int i = 2;
+	bool bDef = false;
+	Hypergraph HG;
+	BinaryFormat BF;
+	chrono::steady_clock::time_point Start;
+
+	if((i < argc) && (strcmp(argv[i], "-def") == 0)) {
+		bDef = true;
+		i++;
+	}
+	if(i != argc-2) {
+		cerr << "Usage: " << argv[0] << " convert [-def] <input file> <output file>" << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	loadHypergraph(&HG, argv[i], bDef);
+
+	cout << "Writing binary hypergraph ... " << endl;
+	Start = chrono::steady_clock::now();
+	BF.writeHypergraph(&HG, argv[i+1]);
+	cout << "Writing binary hypergraph done in " << formatSeconds(microsecondsSince(Start)) << " sec." << endl << endl;
+	cout << "Binary output written to: " << argv[i+1] << endl << endl;
+
+	return EXIT_SUCCESS;
+}
+
+
+int client(int argc, char **argv)
+{
+	int i, iK = 0, iDeadline = 0;
+	double rDeadline;
+	bool bDef = false, bOptimize = false, bPACEOut = false;
+	char *cEnd;
+	const char *cInFormat;
+	string Status, Decomposition, OutFile;
+	size_t iExt;
+	chrono::steady_clock::time_point Start;
+	MappedFile Input;
+	FileWriter Output;
+	Client C;
+
+	for(i=2; (i < argc) && (argv[i][0] == '-'); i++)
+		if(strcmp(argv[i], "-def") == 0)
+			bDef = true;
+		else if(strcmp(argv[i], "--pace") == 0)
+			bPACEOut = true;
+		else if(strcmp(argv[i], "--optimize") == 0)
+			bOptimize = true;
+		else if((strcmp(argv[i], "--deadline") == 0) && (i+1 < argc) && ((rDeadline = strtod(argv[i+1], &cEnd)) >= 0) &&
+			(*cEnd == '\0') && (rDeadline <= 2000000)) {
+			// The deadline is sent in milliseconds; a positive deadline is at least 1 ms
+			iDeadline = (rDeadline > 0) ? max((int)(rDeadline*1000 + 0.5), 1) : 0;
+			i++;
+		}
+		else
+			break;
+	if((i == argc-3) || (bOptimize && (i == argc-2))) {
+		if(i == argc-3)
+			iK = parseWidth(argv[i+1]);
+	}
+	else {
+		cerr << "Usage: " << argv[0] << " client [-def] [--pace] [--optimize] [--deadline <sec>] <socket file> [<k>] <filename>" << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	// Send the file as it is; the server parses it according to its format
+	if(BinaryFormat::isBinaryFile(argv[argc-1]))
+		cInFormat = "binary";
+	else if(PACEFormat::isPACEFile(argv[argc-1])) {
+		cInFormat = "pace";
+		bPACEOut = true;
+	}
+	else
+		cInFormat = bDef ? "text-def" : "text";
+	if(!Input.open(argv[argc-1]))
+		writeErrorMsg("Error opening file.", "client");
+
+	if(!C.connect(argv[i])) {
+		cerr << "No server is listening on \"" << argv[i] << "\"." << endl;
+		exit(EXIT_FAILURE);
+	}
+	Start = chrono::steady_clock::now();
+	C.request(bOptimize ? "optimize" : "decomp", iK, iDeadline, cInFormat, bPACEOut ? "htd" : "gml", Input.getData(), Input.getSize(), &Status, &Decomposition);
+	cout << Status << " (" << chrono::duration<double>(chrono::steady_clock::now() - Start).count() << " sec)" << endl;
+	C.close();
+
+	if(Status.compare(0, 6, "error ") == 0)
+		return EXIT_FAILURE;
+
+	// Write the decomposition next to the input file as in the command line mode
+	if(!Decomposition.empty()) {
+		OutFile = argv[argc-1];
+		iExt = OutFile.find_last_of('.');
+		if((iExt == string::npos) || (iExt == 0) || (OutFile.find_first_of("/\\", iExt) != string::npos))
+			iExt = OutFile.size();
+		OutFile.erase(iExt);
+		OutFile += bPACEOut ? ((Status.compare(0, 6, "found ") == 0) ? ".htd" : ".ghd") : ".gml";
+		if(!Output.open(OutFile.c_str()))
+			writeErrorMsg("Error opening file.", "client");
+		Output << Decomposition.c_str();
+		if(!Output.close())
+			writeErrorMsg("Error writing file.", "client");
+		cout << "Output written to: " << OutFile << endl;
+	}
+
+	return EXIT_SUCCESS;
+}
+
+
+void loadHypergraph(Hypergraph *HG, const char *cFile, bool bDef)
+{
+	chrono::steady_clock::time_point Start;
+	Parser *P;
+	BinaryFormat BF;
+	PACEFormat PF;
+
+	if(BinaryFormat::isBinaryFile(cFile)) {
+		// Load binary file
+		cout << "Loading binary hypergraph \"" << cFile << "\" ... " << endl;
+		Start = chrono::steady_clock::now();
+		BF.readHypergraph(HG, cFile);
+		if(!HG->isConnected())
+			cerr << "Warning: Hypergraph is not connected." << endl;
+		lParseTime = microsecondsSince(Start);
+		cout << "Loading binary hypergraph done in " << formatSeconds(lParseTime) << " sec";
+		cout << " (" << HG->getNbrOfEdges() << " atoms, " << HG->getNbrOfNodes() << " variables)." << endl << endl;
+		return;
+	}
+
+	if(PACEFormat::isPACEFile(cFile)) {
+		// Load file in PACE format and write the decomposition in PACE format as well
+		cout << "Loading PACE hypergraph \"" << cFile << "\" ... " << endl;
+		Start = chrono::steady_clock::now();
+		PF.readHypergraph(HG, cFile);
+		if(!HG->isConnected())
+			cerr << "Warning: Hypergraph is not connected." << endl;
+		lParseTime = microsecondsSince(Start);
+		cout << "Loading PACE hypergraph done in " << formatSeconds(lParseTime) << " sec";
+		cout << " (" << HG->getNbrOfEdges() << " hyperedges, " << HG->getNbrOfNodes() << " vertices)." << endl << endl;
+		bPACE = true;
+		return;
+	}
+
+	// Create parser object
+	if((P = new Parser(bDef)) == NULL)
+		writeErrorMsg("Error assigning memory.", "loadHypergraph");
+
+	// Parse file
+	cout << "Parsing input file \"" << cFile << "\" ... " << endl;
+	Start = chrono::steady_clock::now();
+	P->parseFile(cFile);
+	lParseTime = microsecondsSince(Start);
+	cout << "Parsing input file done in " << formatSeconds(lParseTime) << " sec";
+	cout << " (" << P->getNbrOfAtoms() << " atoms, " << P->getNbrOfVars() << " variables)." << endl << endl;
+	
+	// Build hypergraph
+	cout << "Building hypergraph ... " << endl;
+	Start = chrono::steady_clock::now();
+	HG->buildHypergraph(P);
+	if(!HG->isConnected())
+		cerr << "Warning: Hypergraph is not connected." << endl;
+	lBuildTime = microsecondsSince(Start);
+	cout << "Building hypergraph done in " << formatSeconds(lBuildTime) << " sec." << endl << endl;
+	delete P;
+}
+
+
+void stopSearch(int iSignal)
+{
+	G_StopSearch = 1;
+
+	// A second signal terminates the program immediately
+	signal(iSignal, SIG_DFL);
+}
+
+
+/*
+***Description***
+The function flattens a hypertree built by the search or by the heuristic and releases it.
+
+INPUT:	HG: Hypergraph
+		HT: Hypertree
+OUTPUT: return: Flat hypertree
+*/
+
+FlatHypertree *flatten(Hypergraph *HG, Hypertree *HT)
+{
+	FlatHypertree *FT;
+
+	// Check acyclicity of the hypertree
+	if(HT->isCyclic())
+		writeErrorMsg("Hypertree contains cycles.", "flatten");
+
+	if((FT = new FlatHypertree(HG, HT)) == NULL)
+		writeErrorMsg("Error assigning memory.", "flatten");
+	delete HT;
+
+	return FT;
+}
+
+
+FlatHypertree *decompK(Hypergraph *HG, int iWidth, bool *bStopped)
+{
+	long long lTime;
+	chrono::steady_clock::time_point Start;
 	Hypertree *HT;
+	FlatHypertree *FT = NULL;
 	DetKDecomp Decomp;
-
+	ofstream ProgressFile;
+	TraceWriter Trace;
+
+	Decomp.setCheckpoint(cCheckpointFile, iCheckpointInterval);
+	Decomp.setResume(cResumeFile);
+	Decomp.setRecord(cRecordFile);
+	Decomp.setReplay(cReplayFile);
+	Decomp.setTimeLimit(iTimeLimit);
+	if(bProfile)
+		Decomp.setProfile(&Profile);
+	if((iProgressInterval > 0) && (cProgressFile != NULL)) {
+		ProgressFile.open(cProgressFile, ios::out | ios::app);
+		if(!ProgressFile)
+			writeErrorMsg("Error opening progress file.", "decompK");
+		Decomp.setProgress(&ProgressFile, iProgressInterval);
+	}
+	else if(iProgressInterval > 0)
+		Decomp.setProgress(&cerr, iProgressInterval);
+	if(cTraceFile != NULL) {
+		if(!Trace.open(cTraceFile, lTraceLimit, iTraceDepth))
+			writeErrorMsg("Error opening trace file.", "decompK");
+		Decomp.setTrace(&Trace);
+	}
 	// Apply the decomposition algorithm
-	cout << "Building hypertree (det-" << iWidth << "-decomp) ... " << endl;
-	time(&start);
+	if(cReplayFile != NULL)
+		cout << "Building hypertree (det-" << iWidth << "-decomp) from the record \"" << cReplayFile << "\" ... " << endl;
+	else
+		cout << "Building hypertree (det-" << iWidth << "-decomp) ... " << endl;
+	Start = chrono::steady_clock::now();
 	HT = Decomp.buildHypertree(HG, iWidth);
-	time(&end);
-	if(HT == NULL)
-		cout << "Hypertree of width " << iWidth << " not found in " << difftime(end, start) << " sec." << endl << endl;
+	lTime = microsecondsSince(Start);
+	lOrderTime = Decomp.getOrderTime();
+	lSearchTime = Decomp.getSearchTime();
+	lExpandTime = Decomp.getExpandTime();
+	lNbrOfCalls = Decomp.getNbrOfCalls();
+	lNbrOfSeps = Decomp.getNbrOfSeps();
+	lNbrOfCutParts = Decomp.getNbrOfCutParts();
+	*bStopped = Decomp.isStopped();
+	if(cTraceFile != NULL) {
+		if(!Trace.close())
+			writeErrorMsg("Error writing trace file.", "decompK");
+		cout << "Trace written to: " << cTraceFile << " (" << Trace.getNbrOfEvents() << " events, " << Trace.getNbrOfDropped() << " dropped)." << endl;
+	}
+	if((cRecordFile != NULL) && (HT != NULL))
+		cout << "Record written to: " << cRecordFile << endl;
+	if(*bStopped)
+		cout << "Search for a hypertree of width " << iWidth << " stopped after " << formatSeconds(lTime) << " sec." << endl;
+	else if(HT == NULL)
+		cout << "Hypertree of width " << iWidth << " not found in " << formatSeconds(lTime) << " sec." << endl;
 	else {
-		cout << "Building hypertree done in " << difftime(end, start) << " sec";
-		cout << " (hypertree-width: " << HT->getHTreeWidth() << ")." << endl << endl;
-
-		HT->swapChiLambda();
-		HT->shrink(true);
-		HT->swapChiLambda();
+		cout << "Building hypertree done in " << formatSeconds(lTime) << " sec";
+		cout << " (hypertree-width: " << HT->getHTreeWidth() << ")." << endl;
+
+		Start = chrono::steady_clock::now();
+		FT = flatten(HG, HT);
+		FT->swapChiLambda();
+		FT->shrink(true);
+		FT->swapChiLambda();
+		lShrinkTime = microsecondsSince(Start);
 	}
+	cout << "Search statistics: " << Decomp.getNbrOfCalls() << " decomp calls, " << Decomp.getNbrOfSeps() << " separators, ";
+	cout << Decomp.getNbrOfCutParts() << " pruned components." << endl << endl;
+	if(bProfile)
+		Profile.writeTable(cout);
 
-	return HT;
+	return FT;
 }
 
 
-bool verify(Hypergraph *HG, Hypertree *HT)
+FlatHypertree *decompHeuristic(Hypergraph *HG)
 {
+	chrono::steady_clock::time_point Start;
+	FlatHypertree *FT;
+	BucketElim BE;
+
+	// The search at a single width refutes no width before it is finished
+	cout << "No lower bound on the hypertree-width was established." << endl << endl;
+
+	cout << "Building heuristic decomposition (bucket elimination) ... " << endl;
+	Start = chrono::steady_clock::now();
+	FT = flatten(HG, BE.buildHypertree(HG));
+	lHeuristicTime = microsecondsSince(Start);
+	cout << "Building heuristic decomposition done in " << formatSeconds(lHeuristicTime) << " sec";
+	cout << " (generalized hypertree-width: " << FT->getHTreeWidth() << ")." << endl << endl;
+
+	return FT;
+}
+
+
+bool verify(Hypergraph *HG, FlatHypertree *HT)
+{
+	int iWitnessTree;
 	bool bAllCondSat = true;
 	Node *WitnessNode;
 	Hyperedge *WitnessEdge;
-	Hypertree *WitnessTree;
+	Verifier V((int)thread::hardware_concurrency());
 
-	// Check acyclicity of the hypertree
-	HT->resetLabels();
-	if(HT->isCyclic())
-		writeErrorMsg("Hypertree contains cycles.", "verify");
-	HT->setIDLabels();
+	// Index the hypertree once for all conditions
+	V.index(HG, HT);
 
 	// Check condition 1
 	cout << "Condition 1: ";
 	cout.flush();
-	if((WitnessEdge = HT->checkCond1(HG)) == NULL)
+	if((WitnessEdge = V.checkCond1()) == NULL)
 		cout << "satisfied." << endl;
 	else {
 		cout << "violated! (see atom \"" << WitnessEdge->getName() << "\")" << endl;
@@ -207,7 +692,7 @@ bool verify(Hypergraph *HG, Hypertree *HT)
 	// Check condition 2
 	cout << "Condition 2: ";
 	cout.flush();
-	if((WitnessNode = HT->checkCond2(HG)) == NULL)
+	if((WitnessNode = V.checkCond2()) == NULL)
 		cout << "satisfied." << endl;
 	else {
 		cout << "violated! (see variable \"" << WitnessNode->getName() << "\")" << endl;
@@ -217,22 +702,85 @@ bool verify(Hypergraph *HG, Hypertree *HT)
 	// Check condition 3
 	cout << "Condition 3: ";
 	cout.flush();
-	if((WitnessTree = HT->checkCond3(HG)) == NULL)
+	if((iWitnessTree = V.checkCond3()) < 0)
 		cout << "satisfied." << endl;
 	else {
-		cout << "violated! (see hypertree node \"" << WitnessTree->getLabel() << "\")" << endl;
+		cout << "violated! (see hypertree node \"" << iWitnessTree+1 << "\")" << endl;
 		bAllCondSat = false;
 	}
 
 	// Check condition 4
 	cout << "Condition 4: ";
 	cout.flush();
-	if((WitnessTree = HT->checkCond4(HG)) == NULL)
+	if((iWitnessTree = V.checkCond4()) < 0)
 		cout << "satisfied." << endl;
 	else
 		cout << "violated!" << endl; 
-		// (see hypertree node \"" << WitnessTree->getLabel() << "\")" << endl;
+		// (see hypertree node \"" << iWitnessTree+1 << "\")" << endl;
 
 	return bAllCondSat;
 }
 
+
+string formatSeconds(long long lMicroseconds)
+{
+	char cSeconds[32];
+
+	sprintf(cSeconds, "%.6f", lMicroseconds / 1e6);
+
+	return cSeconds;
+}
+
+
+/*
+***Description***
+The function writes the statistics of a run as JSON object into the file given by --stats-json:
+the instance metrics, the result, the search statistics, the times of the phases in
+microseconds, and the peak resident set size of the process in kilobytes.
+
+INPUT:	HG: Hypergraph
+		iK: Upper bound of the hypertree-width
+		HT: Resulting decomposition (NULL if none was found)
+		bStopped: true if the search was stopped and HT is a heuristic decomposition
+		bVerified: true if HT satisfies all checked hypertree conditions
+OUTPUT: -
+*/
+
+void writeStats(Hypergraph *HG, int iK, FlatHypertree *HT, bool bStopped, bool bVerified)
+{
+	int i, iMaxArity = 0, iMaxDegree = 0;
+	FileWriter Stats;
+
+	for(i=0; i < HG->getNbrOfEdges(); i++)
+		iMaxArity = max(iMaxArity, HG->getEdge(i)->getNbrOfNodes());
+	for(i=0; i < HG->getNbrOfNodes(); i++)
+		iMaxDegree = max(iMaxDegree, HG->getNode(i)->getNbrOfEdges());
+
+	if(!Stats.open(cStatsFile))
+		writeErrorMsg("Error opening file.", "writeStats");
+	Stats << "{\"instance\": " << toJSON(cInpFile).c_str() << ", \"k\": " << iK << ", \"seed\": " << (long long)iSeed;
+	Stats << ", \"status\": " << (bStopped ? "\"stopped\"" : ((HT != NULL) ? "\"found\"" : "\"not_found\""));
+	Stats << ", \"width\": ";
+	if(HT != NULL)
+		Stats << HT->getHTreeWidth();
+	else
+		Stats << "null";
+	Stats << ", \"verified\": " << (bVerified ? "true" : "false");
+	Stats << ", \"atoms\": " << HG->getNbrOfEdges() << ", \"variables\": " << HG->getNbrOfNodes();
+	Stats << ", \"max_arity\": " << iMaxArity << ", \"max_degree\": " << iMaxDegree;
+	Stats << ", \"decomp_calls\": " << lNbrOfCalls;
+	Stats << ", \"separators\": " << lNbrOfSeps;
+	Stats << ", \"pruned_components\": " << lNbrOfCutParts;
+	Stats << ", \"time_us\": {\"parse\": " << lParseTime << ", \"build\": " << lBuildTime << ", \"order\": " << lOrderTime;
+	Stats << ", \"search\": " << lSearchTime << ", \"expand\": " << lExpandTime << ", \"shrink\": " << lShrinkTime;
+	Stats << ", \"heuristic\": " << lHeuristicTime << ", \"verify\": " << lVerifyTime << ", \"output\": " << lOutputTime;
+	Stats << ", \"total\": " << microsecondsSince(ProgramStart) << "}";
+	if(bProfile) {
+		Stats << ", \"levels\": ";
+		Profile.writeJSON(Stats);
+	}
+	Stats << ", \"memory\": " << MemoryAccount::getJSON().c_str();
+	Stats << ", \"peak_rss_kb\": " << getPeakRSS() << "}\n";
+	if(!Stats.close())
+		writeErrorMsg("Error writing file.", "writeStats");
+}
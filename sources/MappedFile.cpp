@@ -0,0 +1,144 @@
+// MappedFile.cpp: implementation of the MappedFile class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <iterator>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+using namespace std;
+
+#include "MappedFile.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+MappedFile::MappedFile()
+{
+	cMyData = NULL;
+	iMySize = 0;
+	bMyMapped = false;
+	bMyBorrowed = false;
+}
+
+
+MappedFile::~MappedFile()
+{
+	close();
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method maps a regular file into memory (advised for sequential access) such that it can
+be scanned in place. Files that cannot be mapped (e.g., pipes or empty files, or on systems 
+without mmap) are read completely into a buffer that is aligned for int arrays.
+
+INPUT:	cNameOfFile: Name of the file
+OUTPUT: return: true if the file could be opened; otherwise false
+*/
+
+bool MappedFile::open(const char *cNameOfFile)
+{
+	ifstream File;
+	char *cBuffer;
+	string Contents;
+
+	close();
+
+#if !defined(_WIN32)
+	int iFile;
+	struct stat FileStat;
+	void *Mapping;
+
+	iFile = ::open(cNameOfFile, O_RDONLY);
+	if (iFile < 0)
+		return false;
+
+	if ((fstat(iFile, &FileStat) == 0) && S_ISREG(FileStat.st_mode) && (FileStat.st_size > 0)) {
+		Mapping = mmap(NULL, (size_t)FileStat.st_size, PROT_READ, MAP_PRIVATE, iFile, 0);
+		if (Mapping != MAP_FAILED) {
+			madvise(Mapping, (size_t)FileStat.st_size, MADV_SEQUENTIAL);
+			cMyData = (const char *)Mapping;
+			iMySize = (size_t)FileStat.st_size;
+			bMyMapped = true;
+		}
+	}
+	::close(iFile);
+#endif
+
+	if (!bMyMapped) {
+		File.open(cNameOfFile, ios::in | ios::binary);
+		if (!File.is_open())
+			return false;
+		Contents.assign(istreambuf_iterator<char>(File), istreambuf_iterator<char>());
+		File.close();
+
+		iMySize = Contents.size();
+		cBuffer = (char *)new int[(iMySize/sizeof(int))+1];
+		if (cBuffer == NULL)
+			writeErrorMsg("Error assigning memory.", "MappedFile::open");
+		Contents.copy(cBuffer, iMySize);
+		cMyData = cBuffer;
+	}
+
+	return true;
+}
+
+
+void MappedFile::assign(const char *cData, size_t iSize)
+{
+	close();
+
+	cMyData = cData;
+	iMySize = iSize;
+	bMyBorrowed = true;
+}
+
+
+void MappedFile::close()
+{
+	if (bMyMapped) {
+#if !defined(_WIN32)
+		munmap((void *)cMyData, iMySize);
+#endif
+	}
+	else if (!bMyBorrowed)
+		delete [] (int *)cMyData;
+
+	bMyMapped = false;
+	bMyBorrowed = false;
+	cMyData = NULL;
+	iMySize = 0;
+}
+
+
+const char *MappedFile::getData()
+{
+	return cMyData;
+}
+
+
+size_t MappedFile::getSize()
+{
+	return iMySize;
+}
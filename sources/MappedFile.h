@@ -0,0 +1,49 @@
+// Models the contents of an input file that is mapped into memory if possible.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_MAPPEDFILE)
+#define CLS_MAPPEDFILE
+
+#include <cstddef>
+
+
+class MappedFile
+{
+private:
+	// Contents of the file (memory-mapped or read into an int-aligned buffer)
+	const char *cMyData;
+	size_t iMySize;
+
+	// Indicates whether cMyData is a memory mapping of the file
+	bool bMyMapped;
+
+	// Indicates whether cMyData is owned by the caller (and thus not released)
+	bool bMyBorrowed;
+
+public:
+	// Constructor
+	MappedFile();
+
+	// Destructor
+	virtual ~MappedFile();
+
+	// Maps a file into memory or reads it completely; returns false if the file cannot be opened
+	bool open(const char *cNameOfFile);
+
+	// Uses contents that are already in memory instead of a file (they are neither copied nor released)
+	void assign(const char *cData, size_t iSize);
+
+	// Releases the contents of the file
+	void close();
+
+	// Returns the contents of the file
+	const char *getData();
+
+	// Returns the size of the file
+	size_t getSize();
+};
+
+
+#endif // !defined(CLS_MAPPEDFILE)
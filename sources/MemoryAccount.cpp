@@ -0,0 +1,90 @@
+// MemoryAccount.cpp: implementation of the MemoryAccount class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <string>
+
+using namespace std;
+
+#include "MemoryAccount.h"
+
+
+// Bytes currently held by each subsystem and their high-water marks; the counters are shared by
+// all threads (e.g., the portfolio workers and the server) and are therefore atomic
+static atomic<long long> MemCurrent[MEM_NBR_OF_SUBSYSTEMS];
+static atomic<long long> MemPeak[MEM_NBR_OF_SUBSYSTEMS];
+
+static const char *MemNames[MEM_NBR_OF_SUBSYSTEMS] = { "parser", "hypergraph", "memo", "hypertree", "search" };
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method adds a number of bytes to the account of a subsystem and raises the high-water mark
+of the subsystem if it is exceeded.
+
+INPUT:	Subsystem: Subsystem that allocated the memory
+		lBytes: Number of bytes allocated
+*/
+
+void MemoryAccount::add(MemSubsystem Subsystem, long long lBytes)
+{
+	long long lCurrent, lPeak;
+
+	lCurrent = (MemCurrent[Subsystem] += lBytes);
+	lPeak = MemPeak[Subsystem].load(memory_order_relaxed);
+	while((lCurrent > lPeak) && !MemPeak[Subsystem].compare_exchange_weak(lPeak, lCurrent, memory_order_relaxed));
+}
+
+
+void MemoryAccount::sub(MemSubsystem Subsystem, long long lBytes)
+{
+	MemCurrent[Subsystem] -= lBytes;
+}
+
+
+long long MemoryAccount::getCurrent(MemSubsystem Subsystem)
+{
+	return MemCurrent[Subsystem].load(memory_order_relaxed);
+}
+
+
+long long MemoryAccount::getPeak(MemSubsystem Subsystem)
+{
+	return MemPeak[Subsystem].load(memory_order_relaxed);
+}
+
+
+const char *MemoryAccount::getName(MemSubsystem Subsystem)
+{
+	return MemNames[Subsystem];
+}
+
+
+/*
+***Description***
+The method returns an object with one member per subsystem that contains the number of bytes 
+currently held and the high-water mark, e.g., {"parser": {"current": 0, "peak": 1024}, ...}.
+
+INPUT:	-
+OUTPUT: return: JSON object
+*/
+
+string MemoryAccount::getJSON()
+{
+	string JSON = "{";
+
+	for(int i=0; i < MEM_NBR_OF_SUBSYSTEMS; i++) {
+		JSON += (i > 0) ? ", \"" : "\"";
+		JSON += string(MemNames[i]) + "\": {\"current\": " + to_string(getCurrent((MemSubsystem)i));
+		JSON += ", \"peak\": " + to_string(getPeak((MemSubsystem)i)) + "}";
+	}
+
+	return JSON + "}";
+}
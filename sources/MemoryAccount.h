@@ -0,0 +1,53 @@
+// Models an account of the memory held by the subsystems of det-k-decomp: the number of bytes
+// currently allocated and the high-water mark of each subsystem.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_MEMORYACCOUNT)
+#define CLS_MEMORYACCOUNT
+
+#include <string>
+
+using namespace std;
+
+
+// Estimated numbers of bytes of an element of type T in a set (red-black tree node with color,
+// parent, left, and right) and in a list (node with previous and next pointers)
+#define MEM_SET_ENTRY(T) (4*sizeof(void *)+sizeof(T))
+#define MEM_LIST_ENTRY(T) (2*sizeof(void *)+sizeof(T))
+
+// Subsystems whose memory is accounted
+enum MemSubsystem {
+	MEM_PARSER,			// Tables and symbol table of the parser
+	MEM_HYPERGRAPH,		// Arrays of the hypergraph and its hyperedges and nodes
+	MEM_MEMO,			// Separators already used and their (un)decomposable components
+	MEM_HYPERTREE,		// Nodes of hypertrees with their chi- and lambda-sets
+	MEM_SEARCH,			// Frames of the explicit stack of the search and their arrays
+	MEM_NBR_OF_SUBSYSTEMS
+};
+
+class MemoryAccount
+{
+public:
+	// Adds a number of bytes allocated by a subsystem
+	static void add(MemSubsystem Subsystem, long long lBytes);
+
+	// Subtracts a number of bytes released by a subsystem
+	static void sub(MemSubsystem Subsystem, long long lBytes);
+
+	// Returns the number of bytes currently held by a subsystem
+	static long long getCurrent(MemSubsystem Subsystem);
+
+	// Returns the maximum number of bytes held by a subsystem at the same time
+	static long long getPeak(MemSubsystem Subsystem);
+
+	// Returns the name of a subsystem
+	static const char *getName(MemSubsystem Subsystem);
+
+	// Returns the current numbers of bytes and the high-water marks as JSON object
+	static string getJSON();
+};
+
+
+#endif // !defined(CLS_MEMORYACCOUNT)
@@ -0,0 +1,265 @@
+// PACEFormat.cpp: implementation of the PACEFormat class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <stdexcept>
+
+using namespace std;
+
+#include "PACEFormat.h"
+#include "Hypergraph.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+PACEFormat::PACEFormat()
+{
+	cMyPos = cMyEnd = NULL;
+	iMyLineNumber = 1;
+}
+
+
+PACEFormat::~PACEFormat()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+void PACEFormat::SyntaxError(const char *cMsg)
+{
+	if (G_ThrowErrors)
+		throw runtime_error("Error in Ln " + to_string(iMyLineNumber) + ": " + cMsg);
+
+	cerr << "Error in Ln " << iMyLineNumber << ": " << cMsg << endl;
+	exit(EXIT_FAILURE);
+}
+
+
+void PACEFormat::SyntaxWarning(const char *cMsg)
+{
+	cerr << "Warning in Ln " << iMyLineNumber << ": " << cMsg << endl;
+}
+
+
+bool PACEFormat::skipSpace()
+{
+	while ((cMyPos < cMyEnd) && ((*cMyPos == ' ') || (*cMyPos == '\t') || (*cMyPos == '\r')))
+		++cMyPos;
+
+	return (cMyPos < cMyEnd) && (*cMyPos != '\n');
+}
+
+
+void PACEFormat::skipLine()
+{
+	const char *cNewline;
+
+	cNewline = (const char *)memchr(cMyPos, '\n', cMyEnd-cMyPos);
+	cMyPos = (cNewline == NULL) ? cMyEnd : cNewline+1;
+	++iMyLineNumber;
+}
+
+
+int PACEFormat::readNumber()
+{
+	int iNumber = 0;
+
+	if ((cMyPos == cMyEnd) || (*cMyPos < '0') || (*cMyPos > '9'))
+		SyntaxError("Number expected.");
+
+	while ((cMyPos < cMyEnd) && (*cMyPos >= '0') && (*cMyPos <= '9')) {
+		if (iNumber > 99999999)
+			SyntaxError("Number too large.");
+		iNumber = (10*iNumber) + (*cMyPos++ - '0');
+	}
+
+	if ((cMyPos < cMyEnd) && (*cMyPos != ' ') && (*cMyPos != '\t') && (*cMyPos != '\r') && (*cMyPos != '\n'))
+		SyntaxError("Illegal character.");
+
+	return iNumber;
+}
+
+
+bool PACEFormat::isPACEFile(const char *cNameOfFile)
+{
+	ifstream File;
+	string Line;
+
+	File.open(cNameOfFile, ios::in | ios::binary);
+	if (!File.is_open())
+		return false;
+
+	// Skip comments and empty lines
+	while (getline(File, Line)) {
+		if ((Line.size() > 0) && (Line[Line.size()-1] == '\r'))
+			Line.erase(Line.size()-1);
+		if (!Line.empty() && (Line[0] != 'c'))
+			return Line.compare(0, 6, "p htd ") == 0;
+	}
+
+	return false;
+}
+
+
+/*
+***Description***
+The method constructs a hypergraph from a file in PACE format. The hyperedges may be given in any
+order; the nodes of each hyperedge are sorted and multiple occurrences are removed. Each node must 
+be contained in some hyperedge since otherwise no hypertree decomposition exists. The names of the
+hyperedges and nodes are their numbers in the file, and their positions in the hypergraph are 
+their numbers minus one such that decompositions can be written in PACE format without renaming.
+
+INPUT:	HGraph: Empty hypergraph
+OUTPUT: HGraph: Hypergraph stored in MyFile
+*/
+
+void PACEFormat::readContents(Hypergraph *HGraph)
+{
+	int i, j, iNbrOfNodes = -1, iNbrOfEdges = 0, iEdge, iNameSize = 0;
+	vector<int> LineStart, LineNodes, LineOf, EdgeNodeStart, EdgeNodes, Degrees;
+	char cNumber[(sizeof(int)*8)+1], cMsg[128], *cNames, *cName, **EdgeNames, **NodeNames;
+
+	cMyPos = MyFile.getData();
+	cMyEnd = cMyPos + MyFile.getSize();
+	iMyLineNumber = 1;
+
+	while (cMyPos < cMyEnd) {
+		// Skip empty lines and comments
+		if (!skipSpace() || (*cMyPos == 'c')) {
+			skipLine();
+			continue;
+		}
+
+		if (*cMyPos == 'p') {
+			// Read the problem line
+			if (iNbrOfNodes >= 0)
+				SyntaxError("Multiple problem lines.");
+			if ((cMyEnd-cMyPos < 6) || (strncmp(cMyPos, "p htd", 5) != 0) || ((cMyPos[5] != ' ') && (cMyPos[5] != '\t')))
+				SyntaxError("Illegal problem line.");
+			cMyPos += 5;
+			skipSpace();
+			iNbrOfNodes = readNumber();
+			skipSpace();
+			iNbrOfEdges = readNumber();
+			LineOf.assign(iNbrOfEdges, -1);
+			Degrees.assign(iNbrOfNodes, 0);
+		}
+		else {
+			// Read a hyperedge
+			if (iNbrOfNodes < 0)
+				SyntaxError("Problem line expected.");
+			iEdge = readNumber();
+			if ((iEdge < 1) || (iEdge > iNbrOfEdges))
+				SyntaxError("Illegal hyperedge number.");
+			if (LineOf[iEdge-1] >= 0)
+				SyntaxError("Hyperedge occurs the second time.");
+			LineOf[iEdge-1] = (int)LineStart.size();
+			LineStart.push_back((int)LineNodes.size());
+			while (skipSpace()) {
+				LineNodes.push_back(readNumber()-1);
+				if ((LineNodes.back() < 0) || (LineNodes.back() >= iNbrOfNodes))
+					SyntaxError("Illegal node number.");
+			}
+
+			// Sort the nodes and remove multiple occurrences
+			sort(LineNodes.begin()+LineStart.back(), LineNodes.end());
+			if (unique(LineNodes.begin()+LineStart.back(), LineNodes.end()) != LineNodes.end()) {
+				SyntaxWarning("Multiple occurrences of a node in a hyperedge.");
+				LineNodes.erase(unique(LineNodes.begin()+LineStart.back(), LineNodes.end()), LineNodes.end());
+			}
+		}
+
+		if (skipSpace())
+			SyntaxError("Illegal character.");
+		skipLine();
+	}
+	LineStart.push_back((int)LineNodes.size());
+	MyFile.close();
+
+	if (iNbrOfNodes < 0)
+		SyntaxError("Problem line expected.");
+
+	// Order the hyperedges by their numbers
+	EdgeNodeStart.push_back(0);
+	for (i=0; i < iNbrOfEdges; i++) {
+		if (LineOf[i] < 0) {
+			strcpy(cMsg, "Hyperedge ");
+			strcat(cMsg, uitoa(i+1, cNumber));
+			strcat(cMsg, " is missing.");
+			writeErrorMsg(cMsg, "PACEFormat::readHypergraph");
+		}
+		for (j=LineStart[LineOf[i]]; j < LineStart[LineOf[i]+1]; j++) {
+			EdgeNodes.push_back(LineNodes[j]);
+			++Degrees[LineNodes[j]];
+		}
+		EdgeNodeStart.push_back((int)EdgeNodes.size());
+	}
+
+	for (i=0; i < iNbrOfNodes; i++)
+		if (Degrees[i] == 0) {
+			strcpy(cMsg, "Node ");
+			strcat(cMsg, uitoa(i+1, cNumber));
+			strcat(cMsg, " is not contained in any hyperedge.");
+			writeErrorMsg(cMsg, "PACEFormat::readHypergraph");
+		}
+
+	// Store the numbers of the hyperedges and nodes as their names
+	for (i=1; i <= iNbrOfEdges; i++)
+		iNameSize += (int)strlen(uitoa(i, cNumber))+1;
+	for (i=1; i <= iNbrOfNodes; i++)
+		iNameSize += (int)strlen(uitoa(i, cNumber))+1;
+	cNames = new char[iNameSize];
+	EdgeNames = new char*[iNbrOfEdges];
+	NodeNames = new char*[iNbrOfNodes];
+	if ((cNames == NULL) || (EdgeNames == NULL) || (NodeNames == NULL))
+		writeErrorMsg("Error assigning memory.", "PACEFormat::readHypergraph");
+	cName = cNames;
+	for (i=0; i < iNbrOfEdges; i++) {
+		EdgeNames[i] = cName;
+		cName += strlen(uitoa(i+1, cName))+1;
+	}
+	for (i=0; i < iNbrOfNodes; i++) {
+		NodeNames[i] = cName;
+		cName += strlen(uitoa(i+1, cName))+1;
+	}
+
+	HGraph->buildHypergraph(iNbrOfEdges, iNbrOfNodes, EdgeNodeStart.data(), EdgeNodes.data(), EdgeNames, NodeNames);
+	HGraph->setNameBlock(cNames);
+
+	delete [] EdgeNames;
+	delete [] NodeNames;
+}
+
+
+void PACEFormat::readHypergraph(Hypergraph *HGraph, const char *cNameOfFile)
+{
+	if (!MyFile.open(cNameOfFile))
+		writeErrorMsg("Error opening file.", "PACEFormat::readHypergraph");
+	readContents(HGraph);
+}
+
+
+void PACEFormat::readHypergraph(Hypergraph *HGraph, const char *cData, size_t iSize)
+{
+	MyFile.assign(cData, iSize);
+	readContents(HGraph);
+}
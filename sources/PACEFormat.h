@@ -0,0 +1,67 @@
+// Models the hypergraph input format of the PACE 2019 challenge (.hg files).
+//
+// After comment lines starting with 'c', the file contains the problem line "p htd <nodes> <edges>"
+// followed by one line "<edge> <node> <node> ..." per hyperedge, where the hyperedges and nodes
+// are numbered from 1.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_PACEFORMAT)
+#define CLS_PACEFORMAT
+
+#include "MappedFile.h"
+
+
+class Hypergraph;
+
+class PACEFormat
+{
+private:
+	// Contents of the input file
+	MappedFile MyFile;
+
+	// Current position in the input and end of the input
+	const char *cMyPos;
+	const char *cMyEnd;
+
+	// Current line number in the input file
+	int iMyLineNumber;
+
+	// Writes a standardized syntax error message to the standard output and aborts the program
+	void SyntaxError(const char *cMsg);
+
+	// Writes a standardized syntax warning message to the standard output and continues the program
+	void SyntaxWarning(const char *cMsg);
+
+	// Skips spaces and tabs; returns false if the end of the line is reached
+	bool skipSpace();
+
+	// Skips the rest of the actual line
+	void skipLine();
+
+	// Reads a non-negative number
+	int readNumber();
+
+	// Constructs a hypergraph from the contents of MyFile
+	void readContents(Hypergraph *HGraph);
+
+public:
+	// Constructor
+	PACEFormat();
+
+	// Destructor
+	virtual ~PACEFormat();
+
+	// Checks whether the first line that is not a comment is a PACE problem line
+	static bool isPACEFile(const char *cNameOfFile);
+
+	// Constructs a hypergraph from a file in PACE format
+	void readHypergraph(Hypergraph *HGraph, const char *cNameOfFile);
+
+	// Constructs a hypergraph from contents in PACE format in memory
+	void readHypergraph(Hypergraph *HGraph, const char *cData, size_t iSize);
+};
+
+
+#endif // !defined(CLS_PACEFORMAT)
@@ -6,9 +6,14 @@
 
 #include <cstdlib>
 #include <cstring>
+#include <algorithm>
+#include <string>
+#include <stdexcept>
 
 #include "Parser.h"
+#include "SymbolTable.h"
 #include "Globals.h"
+#include "MemoryAccount.h"
 
 
 
@@ -19,42 +24,28 @@
 
 Parser::Parser(bool bDef)
 {
-	cMyBuffer[0] = '\0';
-	iMyBufferPos = 0;
+	cMyPos = cMyEnd = cMyIdent = NULL;
+	iMyIdentLength = 0;
 	iMyLineNumber = 1;
 	iMyColumnNumber = 0;
 	iMyEndOfAtoms = 0;
 	iMyNbrOfWarnings = 0;
 	bMyEOF = false;
 	bMyDef = bDef;
+	lMyBytes = 0;
+
+	MySymbols = new SymbolTable;
+	if (MySymbols == NULL)
+		writeErrorMsg("Error assigning memory.", "Parser::Parser");
 }
 
 
 Parser::~Parser()
 {
-	int iDefAtom = 0, iDefVar = 0;
-	vector<set<int> *>::iterator sVectorIter;
-	vector<bool>::iterator bVectorIter;
-
-	for (sVectorIter=MyAtomVars.begin(); sVectorIter != MyAtomVars.end(); sVectorIter++)
-		delete *sVectorIter;
-
-	for (sVectorIter=MyAtomNeighbours.begin(); sVectorIter != MyAtomNeighbours.end(); sVectorIter++)
-		delete *sVectorIter;
-
-	for (sVectorIter=MyVarAtoms.begin(); sVectorIter != MyVarAtoms.end(); sVectorIter++)
-		delete *sVectorIter;
+	// The identifiers are stored in the symbol table unless it was passed to the hypergraph
+	delete MySymbols;
 
-	for (sVectorIter=MyVarNeighbours.begin(); sVectorIter != MyVarNeighbours.end(); sVectorIter++)
-		delete *sVectorIter;
-
-	for (bVectorIter=MyDefAtomUsed.begin(); bVectorIter != MyDefAtomUsed.end(); bVectorIter++, iDefAtom++)
-		if (!*bVectorIter)
-			delete MyDefAtoms[iDefAtom];
-
-	for (bVectorIter=MyDefVarUsed.begin(); bVectorIter != MyDefVarUsed.end(); bVectorIter++, iDefVar++)
-		if (!*bVectorIter)
-			delete MyDefVariables[iDefVar];
+	MemoryAccount::sub(MEM_PARSER, lMyBytes);
 }
 
 
@@ -66,6 +57,13 @@ Parser::~Parser()
 
 void Parser::SyntaxError(const char *cMsg, bool bLineNbr)
 {
+	if (G_ThrowErrors) {
+		if (bLineNbr)
+			throw runtime_error("Error in Ln " + to_string(iMyLineNumber) + ", Col " + to_string(iMyColumnNumber) + ": " + cMsg);
+		else
+			throw runtime_error(string("Error: ") + cMsg);
+	}
+
 	if (bLineNbr)
 		cerr << "Error in Ln " << iMyLineNumber << ", Col " << iMyColumnNumber << ": " << cMsg << endl;
 	else
@@ -84,105 +82,104 @@ void Parser::SyntaxWarning(const char *cMsg, bool bLineNbr)
 }
 
 
-void Parser::fillBuffer()
+// Checks whether a character may occur in an identifier
+static inline bool isIdentChar(char c)
 {
-	if (!MyFile.eof()) {
-		// Reinitialize buffer; this is necessary because of the 'read'-method
-		for(int i=0; i < IF_BUFFER_SIZE; i++)
-			cMyBuffer[i] = '\0';
+	return ((c >= 'A') && (c <= 'Z')) || ((c >= 'a') && (c <= 'z')) || 
+		((c >= '0') && (c <= '9')) || (c == '_') || (c == ':');
+}
 
-		MyFile.read(cMyBuffer, IF_BUFFER_SIZE);
-		iMyBufferPos = 0;
-	}
-	else {
-		bMyEOF = true;
 
-		// If end-token was not found yet
-		if (iMyEndOfAtoms == 0)
-			SyntaxError("Unexpected end of file.", true);
-	}
+void Parser::openFile(const char *cNameOfFile)
+{
+	if (!MyFile.open(cNameOfFile))
+		SyntaxError("Error opening file.");
+}
+
+
+void Parser::closeFile()
+{
+	MyFile.close();
+	cMyPos = cMyEnd = NULL;
+}
+
+
+void Parser::endOfFile()
+{
+	bMyEOF = true;
+
+	// If end-token was not found yet
+	if (iMyEndOfAtoms == 0)
+		SyntaxError("Unexpected end of file.", true);
+}
+
+
+char *Parser::getIdentifier()
+{
+	memcpy(cMyIdentifier, cMyIdent, iMyIdentLength);
+	cMyIdentifier[iMyIdentLength] = '\0';
+
+	return cMyIdentifier;
 }
 
 
 void Parser::readIgnoreText()
 {
-	bool bEndIgnore = false;
+	const char *cNewline;
 
-	do {
-		switch (cMyBuffer[iMyBufferPos]) {
-			case '\0':	// End of buffer reached -> refill
-				fillBuffer();
-				break;
+	while (!bMyEOF) {
+		if (cMyPos >= cMyEnd) {  // End of file reached
+			endOfFile();
+			break;
+		}
+
+		switch (*cMyPos) {
 			case ' ':	// Ignore spaces
-				++iMyBufferPos;
+				++cMyPos;
 				++iMyColumnNumber;
 				break;
 			case 9:		// Ignore tabulators
-				++iMyBufferPos;
+				++cMyPos;
 				++iMyColumnNumber;
 				while(iMyColumnNumber%8 != 1)
 					++iMyColumnNumber;
 				break;
 			case '\n':	// Ignore newlines
-				++iMyBufferPos;
+				++cMyPos;
 				++iMyLineNumber;
 				iMyColumnNumber = 1;
 				break;
-			case '%':	// Ignore comments
-				do {
-					++iMyBufferPos;
-					++iMyColumnNumber;
-					if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-						fillBuffer();
-				} while ((cMyBuffer[iMyBufferPos] != '\n') && !bMyEOF);
-				// Until newline or end of file
+			case '%':	// Ignore comments until newline or end of file
+				cNewline = (const char *)memchr(cMyPos, '\n', cMyEnd-cMyPos);
+				if (cNewline == NULL)
+					cNewline = cMyEnd;
+				iMyColumnNumber += (int)(cNewline-cMyPos);
+				cMyPos = cNewline;
 				break;
 			default:
-				bEndIgnore = true;
+				return;
 		}
-	} while (!bEndIgnore && !bMyEOF);
+	}
 }
 
 
-char *Parser::readIdentifier()
+int Parser::readIdentifier()
 {
-	bool bEndIdentifier = false;
-	char cIdentBuffer[MAX_IDENTIFIER_SIZE + 1], *cIdentifier = NULL;
-	int iIdentifierSize = 0;
-
 	readIgnoreText();
-	do {
-		if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-				fillBuffer();
-		else {
-			if (((cMyBuffer[iMyBufferPos] >= 'A') && (cMyBuffer[iMyBufferPos] <= 'Z')) ||
-				((cMyBuffer[iMyBufferPos] >= 'a') && (cMyBuffer[iMyBufferPos] <= 'z')) ||
-				((cMyBuffer[iMyBufferPos] >= '0') && (cMyBuffer[iMyBufferPos] <= '9')) ||
-				(cMyBuffer[iMyBufferPos] == '_') || (cMyBuffer[iMyBufferPos] == ':')) {
-				
-				// Copy identifier from input file in temporary identifier buffer
-				cIdentBuffer[iIdentifierSize++] = cMyBuffer[iMyBufferPos++];
-				++iMyColumnNumber;
 
-				if (iIdentifierSize > MAX_IDENTIFIER_SIZE)
-					SyntaxError("Maximum length of identifier exceeded.", true);
-			}
-			else
-				bEndIdentifier = true;
-		}
-	} while (!bEndIdentifier);
-	// Until character was found that is not allowed in an identifier
+	// Scan the identifier in place until a character is found that is not allowed in an identifier
+	cMyIdent = cMyPos;
+	while ((cMyPos < cMyEnd) && isIdentChar(*cMyPos))
+		++cMyPos;
+	iMyIdentLength = (int)(cMyPos-cMyIdent);
+	iMyColumnNumber += iMyIdentLength;
 
-	cIdentBuffer[iIdentifierSize] = '\0';
-	if(iIdentifierSize == 0)
+	if (iMyIdentLength > MAX_IDENTIFIER_SIZE)
+		SyntaxError("Maximum length of identifier exceeded.", true);
+	if (iMyIdentLength == 0)
 		SyntaxError("Illegal or missing identifier.", true);
 
-	// Allocate character array for identifier and copy identifier from the identifier buffer in this array
-	cIdentifier = new char[iIdentifierSize + 1];
-	if (cIdentifier == NULL)
-		writeErrorMsg("Error assigning memory.", "Parser::readIdentifier");
-
-	return strcpy(cIdentifier, cIdentBuffer);
+	return iMyIdentLength;
 }
 
 
@@ -192,11 +189,9 @@ bool Parser::readIdentifier(const char *cIdent)
 
 	readIgnoreText();
 	while (cIdent[i] != '\0') {
-		if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-			fillBuffer();
-		if (cMyBuffer[iMyBufferPos] != cIdent[i++])
+		if ((cMyPos >= cMyEnd) || (*cMyPos != cIdent[i++]))
 			return false;
-		++iMyBufferPos;
+		++cMyPos;
 		++iMyColumnNumber;
 	}
 
@@ -211,23 +206,19 @@ int Parser::readArity()
 
 	readIgnoreText();
 	do {
-		if (cMyBuffer[iMyBufferPos] == '\0')  // End of buffer reached -> refill
-				fillBuffer();
-		else {
-			if ((cMyBuffer[iMyBufferPos] >= '0') && (cMyBuffer[iMyBufferPos] <= '9')) {
-				iArity *= 10;
-				iArity += (int)cMyBuffer[iMyBufferPos]-48;
-				++iMyBufferPos;
-				++iMyColumnNumber;
-				++iNbrOfDigits;
-
-				// Maximum number of digits is restricted to 4 (Arity: 1 - 9999)
-				if (iNbrOfDigits == 4)
-					bEndArity = true;
-			}
-			else
+		if ((cMyPos < cMyEnd) && (*cMyPos >= '0') && (*cMyPos <= '9')) {
+			iArity *= 10;
+			iArity += (int)*cMyPos-48;
+			++cMyPos;
+			++iMyColumnNumber;
+			++iNbrOfDigits;
+
+			// Maximum number of digits is restricted to 4 (Arity: 1 - 9999)
+			if (iNbrOfDigits == 4)
 				bEndArity = true;
 		}
+		else
+			bEndArity = true;
 	} while (!bEndArity);
 	// Until a non-numerical character was found or the maximum number of digits was exceeded
 
@@ -240,28 +231,23 @@ int Parser::readArity()
 
 void Parser::readVarDefs()
 {
-	char *cIdentifier = NULL, cErrorMsg[MAX_IDENTIFIER_SIZE + 32];
-	vector<char *>::iterator VectorIter;
+	char cErrorMsg[MAX_IDENTIFIER_SIZE + 32];
+	int iLength;
 
 	do {
-		cIdentifier = readIdentifier();
-
-		// Check whether the variable is already defined
-		VectorIter = MyDefVariables.begin();
-		while ((VectorIter != MyDefVariables.end()) && (strcmp(*VectorIter, cIdentifier) != 0))
-			++VectorIter;
+		iLength = readIdentifier();
 
 		// If the variable is not defined yet
-		if (VectorIter == MyDefVariables.end()) {
+		if (MySymbols->find(SYM_DEF_VAR, cMyIdent, iLength) < 0) {
 			// Store the variable identifier
-			MyDefVariables.push_back(cIdentifier);
+			MyDefVariables.push_back(MySymbols->insert(SYM_DEF_VAR, cMyIdent, iLength, (int)MyDefVariables.size()));
 
 			// Initialize usage of the variable
 			MyDefVarUsed.push_back(false);
 		}
 		else {
 			strcpy(cErrorMsg, "Variable \"");
-			strcat(cErrorMsg, cIdentifier);
+			strcat(cErrorMsg, getIdentifier());
 			strcat(cErrorMsg, "\" is already defined.");
 			SyntaxError(cErrorMsg, true);
 		}
@@ -271,24 +257,19 @@ void Parser::readVarDefs()
 
 void Parser::readAtomDefs()
 {
-	char *cIdentifier = NULL, cErrorMsg[MAX_IDENTIFIER_SIZE + 32];
-	vector<char *>::iterator VectorIter;
+	char cErrorMsg[MAX_IDENTIFIER_SIZE + 32];
+	int iLength;
 
 	do {
-		cIdentifier = readIdentifier();
-
-		// Check whether the atom is already defined
-		VectorIter = MyDefAtoms.begin();
-		while ((VectorIter != MyDefAtoms.end()) && (strcmp(*VectorIter, cIdentifier) != 0))
-			++VectorIter;
+		iLength = readIdentifier();
 
 		// If the atom is not defined yet
-		if (VectorIter == MyDefAtoms.end())
-			// Store the variable identifier
-			MyDefAtoms.push_back(cIdentifier);
+		if (MySymbols->find(SYM_DEF_ATOM, cMyIdent, iLength) < 0)
+			// Store the atom identifier
+			MyDefAtoms.push_back(MySymbols->insert(SYM_DEF_ATOM, cMyIdent, iLength, (int)MyDefAtoms.size()));
 		else {
 			strcpy(cErrorMsg, "Atom \"");
-			strcat(cErrorMsg, cIdentifier);
+			strcat(cErrorMsg, getIdentifier());
 			strcat(cErrorMsg, "\" is already defined.");
 			SyntaxError(cErrorMsg, true);
 		}
@@ -388,61 +369,40 @@ void Parser::readDefinitions()
 
 void Parser::readAtom()
 {
-    char *cIdentifier = NULL;
-	vector<char *>::iterator VectorIter;
-	set<int> *Set = NULL;
 	char cErrorMsg[MAX_IDENTIFIER_SIZE + 64];
-	int iDefAtom = 0, iArity = 0;
+	int iDefAtom = 0, iArity = 0, iLength;
 
-	cIdentifier = readIdentifier();
+	iLength = readIdentifier();
 
 	// Check if the same atom identifier was already used before
-	for (VectorIter=MyAtoms.begin(); VectorIter != MyAtoms.end(); VectorIter++)
-		if (strcmp(*VectorIter, cIdentifier) == 0) {
-			strcpy(cErrorMsg, "Atom identifier \"");
-			strcat(cErrorMsg, cIdentifier);
-			strcat(cErrorMsg, "\" occurs the second time.");
-			SyntaxError(cErrorMsg, true);
-		}
+	if (MySymbols->find(SYM_ATOM, cMyIdent, iLength) >= 0) {
+		strcpy(cErrorMsg, "Atom identifier \"");
+		strcat(cErrorMsg, getIdentifier());
+		strcat(cErrorMsg, "\" occurs the second time.");
+		SyntaxError(cErrorMsg, true);
+	}
 
 	if (bMyDef) {
 		// Check whether the atom is defined
-		VectorIter=MyDefAtoms.begin();
-		while ((VectorIter != MyDefAtoms.end()) && (strcmp(*VectorIter, cIdentifier) != 0)) {
-			++VectorIter;
-			++iDefAtom;
-		}
+		iDefAtom = MySymbols->find(SYM_DEF_ATOM, cMyIdent, iLength);
 
 		// If the atom is not defined
-		if (VectorIter == MyDefAtoms.end()) {
+		if (iDefAtom < 0) {
 			strcpy(cErrorMsg, "Undefined atom \"");
-			strcat(cErrorMsg, cIdentifier);
+			strcat(cErrorMsg, getIdentifier());
 			strcat(cErrorMsg, "\".");
 			SyntaxError(cErrorMsg, true);
 		}
 
 		// Update atom usage
 		MyDefAtomUsed[iDefAtom] = true;
-
-		// Store the atom identifier
-		MyAtoms.push_back(MyDefAtoms[iDefAtom]);
-		delete cIdentifier;
 	}
-	else
-		// Store the atom identifier
-		MyAtoms.push_back(cIdentifier);
 
-	// Allocate a set of variables for the atom
-	Set = new set<int>;
-	if (Set == NULL)
-		writeErrorMsg("Error assigning memory.", "Parser::readAtom");
-	MyAtomVars.push_back(Set);
+	// Store the atom identifier
+	MyAtoms.push_back(MySymbols->insert(SYM_ATOM, cMyIdent, iLength, (int)MyAtoms.size()));
 
-	// Allocate a set of neighbours for the atom
-	Set = new set<int>;
-	if (Set == NULL)
-		writeErrorMsg("Error assigning memory.", "Parser::readAtom");
-	MyAtomNeighbours.push_back(Set);
+	// The variables of the atom start behind those of the previous atom
+	MyAtomVarStart.push_back((int)MyAtomVars.size());
 
 	// Read the atom body
 	readOpenBody();
@@ -452,6 +412,9 @@ void Parser::readAtom()
 	} while (readSeparator());
 	readCloseBody();
 
+	// Sort the variables of the atom
+	sort(MyAtomVars.begin()+MyAtomVarStart.back(), MyAtomVars.end());
+
 	// Check whether the number of arguments equals the defined arity
 	if (bMyDef && (MyArities[iDefAtom] != iArity))
 		SyntaxError("Illegal number of arguments.", true);
@@ -460,122 +423,75 @@ void Parser::readAtom()
 
 void Parser::readVariable()
 {
-	int iVar, iDefVar, iAtom;
-	char *cIdentifier = NULL;
-	vector<char *>::iterator VectorIter;
-	set<int>::iterator SetIter;
-	set<int> *Set = NULL;
-	pair<set<int>::iterator, bool> SetInsertRet;
+	int iVar, iDefVar, iAtom, iLength;
 	char cErrorMsg[(2*MAX_IDENTIFIER_SIZE) + 64];
 
 	iAtom = (int)MyAtoms.size()-1;
-	cIdentifier = readIdentifier();
+	iLength = readIdentifier();
 
 	// Check if the same variable was already used before
-	iVar = iDefVar = 0;
-	VectorIter = MyVariables.begin();
-	while ((VectorIter != MyVariables.end()) && (strcmp(*VectorIter, cIdentifier) != 0)) {
-		++VectorIter;
-		++iVar;
-	}
+	iVar = MySymbols->find(SYM_VAR, cMyIdent, iLength);
 
 	// If the variable did not occur previously
-    if (VectorIter == MyVariables.end()) {
+    if (iVar < 0) {
 
 		if (bMyDef) {
 			// Check whether the variable is defined
-			VectorIter = MyDefVariables.begin();
-			while ((VectorIter != MyDefVariables.end()) && (strcmp(*VectorIter, cIdentifier) != 0)) {
-				++VectorIter;
-				++iDefVar;
-			}
+			iDefVar = MySymbols->find(SYM_DEF_VAR, cMyIdent, iLength);
 
 			// If the variable is not defined
-			if (VectorIter == MyDefVariables.end()) {
+			if (iDefVar < 0) {
 				strcpy(cErrorMsg, "Undefined variable \"");
-				strcat(cErrorMsg, cIdentifier);
+				strcat(cErrorMsg, getIdentifier());
 				strcat(cErrorMsg, "\".");
 				SyntaxError(cErrorMsg, true);
 			}
 
 			// Update variable usage
 			MyDefVarUsed[iDefVar] = true;
-
-			// Store the variable identifier
-			MyVariables.push_back(MyDefVariables[iDefVar]);
-			delete cIdentifier;
 		}
-		else
-			// Store the variable identifier
-			MyVariables.push_back(cIdentifier);
-
-		// Allocate a set of atoms for the variable
-		Set = new set<int>;
-		if (Set == NULL)
-			writeErrorMsg("Error assigning memory.", "Parser::readVariable");
-		MyVarAtoms.push_back(Set);
-
-		// Allocate a set of neighbours for the variable
-		Set = new set<int>;
-		if (Set == NULL)
-			writeErrorMsg("Error assigning memory.", "Parser::readVariable");
-		MyVarNeighbours.push_back(Set);
+
+		// Store the variable identifier
+		iVar = (int)MyVariables.size();
+		MyVariables.push_back(MySymbols->insert(SYM_VAR, cMyIdent, iLength, iVar));
+
+		// The variable does not belong to any atom yet
+		MyVarDegrees.push_back(0);
+		MyVarLastAtom.push_back(-1);
 	}
 
-	// Add variable to the set of variables of the actual atom
-    SetInsertRet = MyAtomVars[iAtom]->insert(iVar);
 	// Write syntax warning if the variable occurs multiple times in the actual atom
-	if (SetInsertRet.second == false) {
+	if (MyVarLastAtom[iVar] == iAtom) {
 		strcpy(cErrorMsg, "Multiple occurrences of variable \"");
-		strcat(cErrorMsg, cIdentifier);
+		strcat(cErrorMsg, getIdentifier());
 		strcat(cErrorMsg, "\" in atom \"");
 		strcat(cErrorMsg, MyAtoms.back());
 		strcat(cErrorMsg, "\".");
 		SyntaxWarning(cErrorMsg, true);
 	}
-
-	// Update the neighbourhood relation between the actual atom and the atoms already stored before
-	for (SetIter=MyVarAtoms[iVar]->begin(); SetIter != MyVarAtoms[iVar]->end(); SetIter++)
-		if (*SetIter != iAtom) {
-			MyAtomNeighbours[*SetIter]->insert(iAtom);
-			MyAtomNeighbours[iAtom]->insert(*SetIter);
-		}
-
-	// Update the neighbourhood relation between the actual variable and the variables already stored before
-	for (SetIter=MyAtomVars[iAtom]->begin(); SetIter != MyAtomVars[iAtom]->end(); SetIter++)
-		if (*SetIter != iVar) {
-			MyVarNeighbours[*SetIter]->insert(iVar);
-			MyVarNeighbours[iVar]->insert(*SetIter);
-		}
-
-	// Add actual atom to the set of atoms of the variable
- 	MyVarAtoms[iVar]->insert(iAtom);
+	else {
+		// Add variable to the variables of the actual atom
+		MyAtomVars.push_back(iVar);
+		MyVarLastAtom[iVar] = iAtom;
+		++MyVarDegrees[iVar];
+	}
 }
 
 
-void Parser::parseFile(const char *cNameOfFile)
+void Parser::parse()
 {
 	int iDefVar = 0, iDefAtom = 0;
 	char cErrorMsg[96], cLineNumber[(sizeof(int)*8)+1];
 	vector<bool>::iterator bVectorIter;
-	vector<char *>::iterator cVectorIter;
-
-	// Open input file stream
-	MyFile.open(cNameOfFile, ios::in);
 
-	// Check if file opening was successful
-	if(!MyFile.is_open())
-		SyntaxError("Error opening file.");
+	cMyPos = MyFile.getData();
+	cMyEnd = cMyPos + MyFile.getSize();
 
 	// Read definitions of variables and relations
 	readDefinitions();
 
-	// Delete all definition informations
+	// Delete all definition informations (the identifiers remain in the symbol table)
 	if (!bMyDef) {
-		for (cVectorIter=MyDefAtoms.begin(); cVectorIter != MyDefAtoms.end(); cVectorIter++)
-			delete *cVectorIter;
-		for (cVectorIter=MyDefVariables.begin(); cVectorIter != MyDefVariables.end(); cVectorIter++)
-			delete *cVectorIter;
 		MyDefAtoms.clear();
 		MyDefVariables.clear();
 		MyArities.clear();
@@ -592,8 +508,9 @@ void Parser::parseFile(const char *cNameOfFile)
 	// Read the text after the end-token
 	readIgnoreText();
 
-	// Close input file stream
-	MyFile.close();
+	// Release the input file
+	closeFile();
+	account();
 
 	// Write syntax warning if EOF does not appear during reading the ignore text, i.e., there appears
 	// some text after the end-token was found
@@ -626,59 +543,76 @@ void Parser::parseFile(const char *cNameOfFile)
 }
 
 
-int Parser::getNbrOfAtoms()
+/*
+***Description***
+The method adds the bytes held by the vectors of atoms, variables, and definitions to the memory
+account of the parser. The bytes are determined by the capacities of the vectors since they
+have only been filled by push_back; the account is replaced if the method is called again.
+*/
+
+void Parser::account()
 {
-	return (int)MyAtoms.size();
+	long long lBytes;
+
+	lBytes = (long long)(MyDefAtoms.capacity() + MyDefVariables.capacity() + MyAtoms.capacity() + MyVariables.capacity())*sizeof(char *);
+	lBytes += (long long)(MyArities.capacity() + MyAtomVars.capacity() + MyAtomVarStart.capacity() + MyVarDegrees.capacity() + MyVarLastAtom.capacity())*sizeof(int);
+	lBytes += (long long)(MyDefAtomUsed.capacity() + MyDefVarUsed.capacity())/8;
+
+	MemoryAccount::add(MEM_PARSER, lBytes-lMyBytes);
+	lMyBytes = lBytes;
 }
 
 
-int Parser::getNbrOfVars()
+void Parser::parseFile(const char *cNameOfFile)
 {
-	return (int)MyVariables.size();
+	// Map the input file into memory
+	openFile(cNameOfFile);
+	parse();
 }
 
 
-int Parser::getNbrOfVars(int iAtom)
+void Parser::parseData(const char *cData, size_t iSize)
 {
-	if (iAtom >= (int)MyAtomVars.size()) {
-		writeErrorMsg("Position not available.", "Parser::getNbrOfVars");
-		return 0;
-	}
-	else
-		return (int)MyAtomVars[iAtom]->size();
+	// Scan the contents in place
+	MyFile.assign(cData, iSize);
+	parse();
 }
 
 
-int Parser::getNbrOfAtoms(int iVar)
+int Parser::getNbrOfAtoms()
 {
-	if (iVar >= (int)MyVarAtoms.size()) {
-		writeErrorMsg("Position not available.", "Parser::getNbrOfAtoms");
-		return 0;
-	}
-	else
-		return (int)MyVarAtoms[iVar]->size();
+	return (int)MyAtoms.size();
 }
 
 
-int Parser::getNbrOfAtomNeighbours(int iAtom)
+int Parser::getNbrOfVars()
+{
+	return (int)MyVariables.size();
+}
+
+
+int Parser::getNbrOfVars(int iAtom)
 {
-	if (iAtom >= (int)MyAtomNeighbours.size()) {
-		writeErrorMsg("Position not available.", "Parser::getNbrOfAtomNeighbours");
+	if (iAtom >= (int)MyAtomVarStart.size()) {
+		writeErrorMsg("Position not available.", "Parser::getNbrOfVars");
 		return 0;
 	}
 	else
-		return (int)MyAtomNeighbours[iAtom]->size();
+		if (iAtom+1 < (int)MyAtomVarStart.size())
+			return MyAtomVarStart[iAtom+1] - MyAtomVarStart[iAtom];
+		else
+			return (int)MyAtomVars.size() - MyAtomVarStart[iAtom];
 }
 
 
-int Parser::getNbrOfVarNeighbours(int iVar)
+int Parser::getNbrOfAtoms(int iVar)
 {
-	if (iVar >= (int)MyVarNeighbours.size()) {
-		writeErrorMsg("Position not available.", "Parser::getNbrOfVarNeighbours");
+	if (iVar >= (int)MyVarDegrees.size()) {
+		writeErrorMsg("Position not available.", "Parser::getNbrOfAtoms");
 		return 0;
 	}
 	else
-		return (int)MyVarNeighbours[iVar]->size();
+		return MyVarDegrees[iVar];
 }
 
 
@@ -710,110 +644,21 @@ char *Parser::getVariable(int iVar)
 }
 
 
-int Parser::getNextAtomVar(bool bReset)
+SymbolTable *Parser::releaseSymbols()
 {
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyAtomVars.begin();
-		if(VectorIter == MyAtomVars.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomVar");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
-	}
-	else
-		++SetIter;  // Increment the iterator
-
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyAtomVars.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomVar");
-		SetIter = (*VectorIter)->begin();
-	}
+	SymbolTable *Symbols = MySymbols;
 
-	return *SetIter;  // Return the next neighbour index
+	MySymbols = NULL;
+	return Symbols;
 }
 
 
-int Parser::getNextVarAtom(bool bReset)
+const int *Parser::getAtomVars(int iAtom)
 {
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyVarAtoms.begin();
-		if(VectorIter == MyVarAtoms.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarAtom");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
-	}
-	else
-		++SetIter;  // Increment the iterator
-
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyVarAtoms.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarAtom");
-		SetIter = (*VectorIter)->begin();
-	}
-
-	return *SetIter;  // Return the next neighbour index
-}
-
-
-int Parser::getNextAtomNeighbour(bool bReset)
-{
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyAtomNeighbours.begin();
-		if(VectorIter == MyAtomNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomNeighbour");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
-	}
-	else
-		++SetIter;  // Increment the iterator
-
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyAtomNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextAtomNeighbour");
-		SetIter = (*VectorIter)->begin();
-	}
-
-	return *SetIter;  // Return the next neighbour index
-}
-
-
-int Parser::getNextVarNeighbour(bool bReset)
-{
-	static vector<set<int> *>::iterator VectorIter;
-	static set<int>::iterator SetIter;
-	static bool bFirstCall = true;
-
-	// Initialize resp. reset the iterator
-	if(bFirstCall || bReset) {
-		VectorIter = MyVarNeighbours.begin();
-		if(VectorIter == MyVarNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarNeighbour");
-		SetIter = (*VectorIter)->begin();
-		bFirstCall = false;
+	if (iAtom >= (int)MyAtomVarStart.size()) {
+		writeErrorMsg("Position not available.", "Parser::getAtomVars");
+		return NULL;
 	}
 	else
-		++SetIter;  // Increment the iterator
-
-	while(SetIter == (*VectorIter)->end()) {
-		if(++VectorIter == MyVarNeighbours.end())
-			writeErrorMsg("Position not available.", "Parser::getNextVarNeighbour");
-		SetIter = (*VectorIter)->begin();
-	}
-
-	return *SetIter;  // Return the next neighbour index
+		return MyAtomVars.data() + MyAtomVarStart[iAtom];
 }
-
@@ -10,26 +10,39 @@
 #include <iostream>
 #include <fstream>
 #include <vector>
-#include <set>
+
+#include "MappedFile.h"
 
 using namespace std;
 
 
-#define IF_BUFFER_SIZE 1024
 #define MAX_IDENTIFIER_SIZE 128
 
+// Name spaces of the identifiers in the symbol table
+#define SYM_DEF_ATOM 0
+#define SYM_DEF_VAR 1
+#define SYM_ATOM 2
+#define SYM_VAR 3
+
+
+class SymbolTable;
 
 class Parser 
 {
 private:
-	// Input file stream
-    ifstream MyFile;
+	// Contents of the input file
+	MappedFile MyFile;
+
+	// Current position in the input and end of the input
+	const char *cMyPos;
+	const char *cMyEnd;
 
-	// Internal buffer for file data
-	char cMyBuffer[IF_BUFFER_SIZE];
+	// Last identifier read from the input (not terminated by '\0') and its length
+	const char *cMyIdent;
+	int iMyIdentLength;
 
-	// Current position in the internal buffer cMyBuffer
-	int iMyBufferPos;
+	// Buffer for a '\0'-terminated copy of the last identifier
+	char cMyIdentifier[MAX_IDENTIFIER_SIZE + 1];
 
 	// Current line number in the input file
 	int iMyLineNumber;
@@ -49,6 +62,12 @@ private:
 	// Boolean value indicating whether definitions have to be checked
 	bool bMyDef;
 
+	// Number of bytes held by the vectors below (added to the memory account after parsing)
+	long long lMyBytes;
+
+	// Symbol table mapping the identifiers to their positions in the vectors below
+	SymbolTable *MySymbols;
+
 	// Pointers to the atom identifiers
 	vector<char *> MyDefAtoms;
 
@@ -70,21 +89,18 @@ private:
 	// Pointers to the variable identifiers
 	vector<char *> MyVariables;
 
-	// Pointers to sets of variables belonging to an atom;
-	// the numbers in the sets refer to variables in MyVariables
-	vector<set<int> *> MyAtomVars;
+	// Variables of all atoms stored consecutively, those of each atom in ascending order;
+	// the numbers refer to variables in MyVariables
+	vector<int> MyAtomVars;
 
-	// Pointers to sets of neighbour atoms belonging to an atom;
-	// the numbers in the sets refer to atoms in MyAtoms
-	vector<set<int> *> MyAtomNeighbours;
+	// Positions in MyAtomVars at which the variables of the atoms start
+	vector<int> MyAtomVarStart;
 
-	// Pointers to sets of atoms to which a variable belongs;
-	// the numbers in the sets refer to atoms in MyAtoms
-	vector<set<int> *> MyVarAtoms;
+	// Numbers of atoms to which the variables belong
+	vector<int> MyVarDegrees;
 
-	// Pointers to sets of neighbour variables belonging to a variable;
-	// the numbers in the sets refer to variables in MyVariables
-	vector<set<int> *> MyVarNeighbours;
+	// Last atom in which a variable occurred (used to detect multiple occurrences)
+	vector<int> MyVarLastAtom;
 
    	// Writes a standardized syntax error message to the standard output and aborts the program
 	void SyntaxError(const char *cMsg, bool bLineNbr = false);
@@ -92,14 +108,23 @@ private:
 	// Writes a standardized syntax warning message to the standard output and continues the program
 	void SyntaxWarning(const char *cMsg, bool bLineNbr = false);
 
-	// Fills the internal file buffer cMyBuffer
-	void fillBuffer();
+	// Opens the input file
+	void openFile(const char *cNameOfFile);
+
+	// Releases the contents of the input file
+	void closeFile();
+
+	// Handles the end of the input file
+	void endOfFile();
+
+	// Returns a '\0'-terminated copy of the last identifier
+	char *getIdentifier();
 
 	// Reads text from the input file that can be ignored (e.g., space, newline, ...)
 	void readIgnoreText();
 
 	// Reads an identifier (i.e., name of an atom or a variable) from the input file
-	char *readIdentifier();
+	int readIdentifier();
 
 	// Reads an identifier given as argument
 	bool readIdentifier(const char *cIdent);
@@ -140,6 +165,12 @@ private:
 	// Reads a variable from the file and stores the information in the above data structures
 	void readVariable();
 
+	// Parses the opened input file and stores the information in internal data structures
+	void parse();
+
+	// Adds the bytes held by the vectors to the memory account
+	void account();
+
 public:
 	// Constructor
 	Parser(bool bDef);
@@ -150,6 +181,9 @@ public:
 	// Parses the hypergraph in a given file and stores the information in internal data structures
 	void parseFile(const char *cNameOfFile);
 
+	// Parses a hypergraph given as contents in memory (e.g., received over a socket)
+	void parseData(const char *cData, size_t iSize);
+
 	// Returns the number of atoms currently stored in the data structures
 	int getNbrOfAtoms();
 
@@ -162,12 +196,6 @@ public:
 	// Returns the number of atoms to which a given variable belongs
 	int getNbrOfAtoms(int iVar);
 
-	// Returns the number of atoms that are neighbours (i.e., have common variables) of a given atom
-    int getNbrOfAtomNeighbours(int iAtom);
-
-	// Returns the number of variables that are neighbours (i.e., have common atoms) of a given variable
-    int getNbrOfVarNeighbours(int iVar);
-
 	// Returns the number of syntax warnings
 	int getNbrOfWarnings();
 	
@@ -177,21 +205,11 @@ public:
 	// Returns the name of the iVar-th variable
 	char *getVariable(int iVar);
 
-	// Returns successively the variables belonging to atoms in the following order:
-	// V0 of A0, V1 of A0, V2 of A0, ..., Vn0 of A0, V0 of A1, V1 of A1, ..., Vn1 of A1, V0 of A2, ...
-	int getNextAtomVar(bool bReset = false);
-
-	// Returns successively the atoms to which the variables belong in the following order:
-	// A0 of V0, A1 of V0, A2 of V0, ..., An0 of V0, A0 of V1, A1 of V1, ..., An1 of V1, A0 of V2, ...
-	int getNextVarAtom(bool bReset = false);
-
-	// Returns successively the neighbours belonging to atoms in the following order:
-	// N0 of A0, N1 of A0, N2 of A0, ..., Nn0 of A0, N0 of A1, N1 of A1, ..., Nn1 of A1, N0 of A2, ...
-	int getNextAtomNeighbour(bool bReset = false);
+	// Passes the symbol table storing the names of the atoms and variables to the caller
+	SymbolTable *releaseSymbols();
 
-	// Returns successively the neighbours belonging to variables in the following order:
-	// N0 of V0, N1 of V0, N2 of V0, ..., Nn0 of V0, N0 of V1, N1 of V1, ..., Nn1 of V1, N0 of V2, ...
-	int getNextVarNeighbour(bool bReset = false);
+	// Returns the variables of the iAtom-th atom in ascending order
+	const int *getAtomVars(int iAtom);
 };
 
 
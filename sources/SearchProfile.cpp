@@ -0,0 +1,126 @@
+// SearchProfile.cpp: implementation of the SearchProfile class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstring>
+#include <iomanip>
+#include <string>
+
+using namespace std;
+
+#include "SearchProfile.h"
+#include "FileWriter.h"
+
+// Width of the histogram bars in the table
+#define PROF_BAR_WIDTH 30
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+SearchProfile::SearchProfile()
+{
+}
+
+
+SearchProfile::~SearchProfile()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+void SearchProfile::clear()
+{
+	MyLevels.clear();
+}
+
+
+/*
+***Description***
+The method returns the counters of a recursion level; the levels up to iRecLevel are created
+with all counters set to zero if they were not reached before.
+
+INPUT:	iRecLevel: Recursion level
+OUTPUT: return: Counters of the recursion level
+*/
+
+ProfileLevel *SearchProfile::getLevel(int iRecLevel)
+{
+	ProfileLevel Empty;
+
+	if(iRecLevel >= (int)MyLevels.size()) {
+		memset(&Empty, 0, sizeof(Empty));
+		MyLevels.resize(iRecLevel+1, Empty);
+	}
+
+	return &MyLevels[iRecLevel];
+}
+
+
+int SearchProfile::getNbrOfLevels()
+{
+	return (int)MyLevels.size();
+}
+
+
+/*
+***Description***
+The method writes one line per recursion level with the counters and a bar whose length is
+proportional to the number of decomp calls on this level. The average component size is the
+number of hyperedges per decomp call.
+
+INPUT:	Out: Output stream
+OUTPUT: -
+*/
+
+void SearchProfile::writeTable(ostream &Out)
+{
+	int i, iBar;
+	long long lMaxCalls = 0;
+	ProfileLevel *L;
+
+	for(i=0; i < (int)MyLevels.size(); i++)
+		if(MyLevels[i].lCalls > lMaxCalls)
+			lMaxCalls = MyLevels[i].lCalls;
+
+	Out << "Search profile per recursion level:" << endl;
+	Out << "level       calls  backtracks      covers      pruned        seps    sep-hits  sep-misses   fail-hits   succ-hits  avg-size  max-size" << endl;
+	for(i=0; i < (int)MyLevels.size(); i++) {
+		L = &MyLevels[i];
+		Out << setw(5) << i << setw(12) << L->lCalls << setw(12) << L->lBacktracks << setw(12) << L->lCovers;
+		Out << setw(12) << L->lCoverPrunes << setw(12) << L->lSeps << setw(12) << L->lSepHits << setw(12) << L->lSepMisses;
+		Out << setw(12) << L->lFailHits << setw(12) << L->lSuccHits;
+		Out << setw(10) << fixed << setprecision(1) << ((L->lCalls > 0) ? (double)L->lCompEdges / L->lCalls : 0.0);
+		Out << setw(10) << L->iMaxCompEdges << "  ";
+		iBar = (lMaxCalls > 0) ? (int)((L->lCalls * PROF_BAR_WIDTH + lMaxCalls - 1) / lMaxCalls) : 0;
+		Out << string(iBar, '#') << endl;
+	}
+	Out.unsetf(ios::floatfield);
+	Out << endl;
+}
+
+
+void SearchProfile::writeJSON(FileWriter &Out)
+{
+	int i;
+	ProfileLevel *L;
+
+	Out << "[";
+	for(i=0; i < (int)MyLevels.size(); i++) {
+		L = &MyLevels[i];
+		Out << ((i > 0) ? ", " : "") << "{\"level\": " << i << ", \"calls\": " << L->lCalls << ", \"backtracks\": " << L->lBacktracks;
+		Out << ", \"covers\": " << L->lCovers << ", \"cover_prunes\": " << L->lCoverPrunes << ", \"separators\": " << L->lSeps;
+		Out << ", \"sep_hits\": " << L->lSepHits << ", \"sep_misses\": " << L->lSepMisses << ", \"fail_hits\": " << L->lFailHits;
+		Out << ", \"succ_hits\": " << L->lSuccHits << ", \"component_edges\": " << L->lCompEdges << ", \"max_component_edges\": " << L->iMaxCompEdges << "}";
+	}
+	Out << "]";
+}
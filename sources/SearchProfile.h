@@ -0,0 +1,71 @@
+// Models a profile of the search of det-k-decomp: counters of the search tree broken down by
+// recursion level.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_SEARCHPROFILE)
+#define CLS_SEARCHPROFILE
+
+#include <vector>
+#include <ostream>
+
+using namespace std;
+
+
+class FileWriter;
+
+// Counters of the decomp calls on one recursion level
+struct ProfileLevel
+{
+	// Number of decomp calls and of decomp calls that failed (i.e., backtracked)
+	long long lCalls, lBacktracks;
+
+	// Number of selections of covering hyperedges enumerated by setInitSubset/setNextSubset and
+	// number of branches of this enumeration pruned in coverNodes
+	long long lCovers, lCoverPrunes;
+
+	// Number of examined separators and how often they were found in (hits) or added to (misses)
+	// the list of separators already used
+	long long lSeps, lSepHits, lSepMisses;
+
+	// Number of components found among the undecomposable (FailParts) and decomposable (SuccParts)
+	// components of a separator already used
+	long long lFailHits, lSuccHits;
+
+	// Sum and maximum of the numbers of hyperedges in the components of the decomp calls
+	long long lCompEdges;
+	int iMaxCompEdges;
+};
+
+class SearchProfile
+{
+private:
+	// Counters of each recursion level
+	vector<ProfileLevel> MyLevels;
+
+public:
+	// Constructor
+	SearchProfile();
+
+	// Destructor
+	virtual ~SearchProfile();
+
+	// Resets all counters
+	void clear();
+
+	// Returns the counters of a recursion level
+	ProfileLevel *getLevel(int iRecLevel);
+
+	// Returns the number of recursion levels reached
+	int getNbrOfLevels();
+
+	// Writes the counters as table with a histogram of the decomp calls per level
+	void writeTable(ostream &Out);
+
+	// Writes the counters as JSON array with one object per level
+	void writeJSON(FileWriter &Out);
+};
+
+
+#endif // !defined(CLS_SEARCHPROFILE)
@@ -0,0 +1,408 @@
+// Server.cpp: implementation of the Server class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#define _CRT_SECURE_NO_DEPRECATE
+
+#include <cstdlib>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <iostream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+#include <chrono>
+#include <csignal>
+
+#if !defined(_WIN32)
+#include <unistd.h>
+#include <poll.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#endif
+
+using namespace std;
+
+#include "Server.h"
+#include "Parser.h"
+#include "BinaryFormat.h"
+#include "PACEFormat.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "FlatHypertree.h"
+#include "DetKDecomp.h"
+#include "BucketElim.h"
+#include "FileWriter.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+Server::Server(int iMaxPending, unsigned int iSeed)
+{
+	iMyListener = -1;
+	iMyMaxPending = iMaxPending;
+	bMyShutdown = false;
+	iMySeed = iSeed;
+}
+
+
+Server::~Server()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(_WIN32)
+
+// Receives exactly iSize bytes; returns false if the connection was closed or timed out before
+static bool receive(int iSocket, char *cBuffer, size_t iSize)
+{
+	ssize_t iRead;
+
+	while(iSize > 0) {
+		iRead = recv(iSocket, cBuffer, iSize, 0);
+		if(iRead < 0 && errno == EINTR)
+			continue;
+		if(iRead <= 0)
+			return false;
+		cBuffer += iRead;
+		iSize -= (size_t)iRead;
+	}
+
+	return true;
+}
+
+
+void Server::listen(const char *cSocketFile)
+{
+	struct sockaddr_un Address;
+	int iClient = -1;
+	bool bUsed;
+
+	if(strlen(cSocketFile) >= sizeof(Address.sun_path))
+		writeErrorMsg("Socket file name too long.", "Server::listen");
+	memset(&Address, 0, sizeof(Address));
+	Address.sun_family = AF_UNIX;
+	strcpy(Address.sun_path, cSocketFile);
+
+	if((iMyListener = socket(AF_UNIX, SOCK_STREAM, 0)) < 0)
+		writeErrorMsg("Error creating socket.", "Server::listen");
+
+	if(bind(iMyListener, (struct sockaddr *)&Address, sizeof(Address)) < 0) {
+		// Remove the socket file of a server that is not running anymore
+		if(errno != EADDRINUSE)
+			writeErrorMsg("Error binding socket.", "Server::listen");
+		iClient = socket(AF_UNIX, SOCK_STREAM, 0);
+		if(iClient < 0)
+			writeErrorMsg("Error binding socket.", "Server::listen");
+		bUsed = (connect(iClient, (struct sockaddr *)&Address, sizeof(Address)) == 0);
+		::close(iClient);
+		if(bUsed)
+			writeErrorMsg("Socket is used by another server.", "Server::listen");
+		unlink(cSocketFile);
+		if(bind(iMyListener, (struct sockaddr *)&Address, sizeof(Address)) < 0)
+			writeErrorMsg("Error binding socket.", "Server::listen");
+	}
+
+	if(::listen(iMyListener, SOMAXCONN) < 0)
+		writeErrorMsg("Error listening on socket.", "Server::listen");
+	MySocketFile = cSocketFile;
+}
+
+
+void Server::loadHypergraph(Hypergraph *HGraph, const char *cFormat, const char *cData, size_t iSize)
+{
+	Parser *P;
+	BinaryFormat BF;
+	PACEFormat PF;
+
+	if(strcmp(cFormat, "binary") == 0)
+		BF.readHypergraph(HGraph, cData, iSize);
+	else if(strcmp(cFormat, "pace") == 0)
+		PF.readHypergraph(HGraph, cData, iSize);
+	else {
+		P = new Parser(strcmp(cFormat, "text-def") == 0);
+		try {
+			P->parseData(cData, iSize);
+			HGraph->buildHypergraph(P);
+		}
+		catch(...) {
+			delete P;
+			throw;
+		}
+		delete P;
+	}
+}
+
+
+/*
+***Description***
+The method searches for a decomposition of a hypergraph. For "decomp" requests, det-k-decomp is
+applied with the given k; for "optimize" requests, det-k-decomp is applied with k = 1, 2, ...
+(up to the given k if k > 0) until a decomposition is found, i.e., the first decomposition found
+has minimal width. If the deadline is exceeded, a heuristic decomposition obtained by bucket
+elimination is returned instead (as for a stopped search in the command line mode).
+
+INPUT:	HGraph: Hypergraph
+		bOptimize: true for "optimize" requests; false for "decomp" requests
+		iK: Upper bound of the hypertree-width
+		iDeadline: Number of milliseconds after which the search is stopped (0 if unlimited)
+OUTPUT: Status: "found", "stopped", or "not_found"
+		return: Decomposition of HGraph; NULL if no decomposition was found
+*/
+
+FlatHypertree *Server::decompose(Hypergraph *HGraph, bool bOptimize, int iK, int iDeadline, string *Status)
+{
+	int iWidth, iMaxWidth;
+	long long lElapsed;
+	chrono::steady_clock::time_point Start;
+	Hypertree *HT = NULL;
+	FlatHypertree *FT = NULL;
+	BucketElim BE;
+
+	Start = chrono::steady_clock::now();
+	*Status = "not_found";
+	iMaxWidth = bOptimize ? ((iK > 0) ? iK : max(HGraph->getNbrOfEdges(), 1)) : iK;
+	for(iWidth=bOptimize ? 1 : iK; (iWidth <= iMaxWidth) && (*Status == "not_found"); iWidth++) {
+		DetKDecomp Decomp;
+
+		lElapsed = (long long)chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - Start).count();
+		if((iDeadline > 0) && (lElapsed >= iDeadline)) {
+			*Status = "stopped";
+			break;
+		}
+		Decomp.setVerbose(false);
+		Decomp.setTimeLimitMs((iDeadline > 0) ? iDeadline-lElapsed : 0);
+		HT = Decomp.buildHypertree(HGraph, iWidth);
+		if(Decomp.isStopped())
+			*Status = "stopped";
+		else if(HT != NULL) {
+			*Status = "found";
+			if((FT = new FlatHypertree(HGraph, HT)) == NULL)
+				writeErrorMsg("Error assigning memory.", "Server::decompose");
+			delete HT;
+			FT->swapChiLambda();
+			FT->shrink(true);
+			FT->swapChiLambda();
+		}
+	}
+
+	if(*Status == "stopped") {
+		HT = BE.buildHypertree(HGraph);
+		if((FT = new FlatHypertree(HGraph, HT)) == NULL)
+			writeErrorMsg("Error assigning memory.", "Server::decompose");
+		delete HT;
+	}
+
+	return FT;
+}
+
+
+void Server::sendError(int iSocket, const string &Message)
+{
+	FileWriter Answer;
+	string Line = Message;
+	size_t i;
+
+	// The message must fit into the status line
+	for(i=0; i < Line.size(); i++)
+		if((Line[i] == '\n') || (Line[i] == '\r'))
+			Line[i] = ' ';
+
+	if(Answer.open(iSocket)) {
+		Answer << "error " << Line.c_str() << '\n';
+		Answer.close();
+	}
+}
+
+
+/*
+***Description***
+The method reads a request from a connection, searches for the requested decomposition, and
+writes the status line and the decomposition into the connection. Errors in the request or in
+the hypergraph are answered by an error status line. Finally, the connection is closed.
+
+INPUT:	iSocket: Connection to a client
+OUTPUT: -
+*/
+
+void Server::handleRequest(int iSocket)
+{
+	int iK, iDeadline, iLength = 0;
+	long long lSize;
+	bool bOptimize;
+	char cHeader[SRV_MAX_HEADER+1], cCommand[16], cInFormat[16], cOutFormat[16], *cData = NULL;
+	string Status;
+	struct timeval Timeout;
+	FileWriter Answer;
+	Hypergraph HG;
+	FlatHypertree *HT = NULL;
+
+	// Drop clients that do not send their request in time
+	Timeout.tv_sec = SRV_RECV_TIMEOUT;
+	Timeout.tv_usec = 0;
+	setsockopt(iSocket, SOL_SOCKET, SO_RCVTIMEO, &Timeout, sizeof(Timeout));
+
+	// Each request uses the same random sequence regardless of the worker
+	random_init(iMySeed);
+
+	try {
+		// Read the header line
+		do {
+			if((iLength == SRV_MAX_HEADER) || !receive(iSocket, cHeader+iLength, 1))
+				writeErrorMsg("Incomplete request header.", "Server::handleRequest");
+		} while(cHeader[iLength++] != '\n');
+		cHeader[iLength] = '\0';
+
+		if((sscanf(cHeader, "%15s %d %d %15s %15s %lld", cCommand, &iK, &iDeadline, cInFormat, cOutFormat, &lSize) != 6) ||
+			((strcmp(cCommand, "decomp") != 0) && (strcmp(cCommand, "optimize") != 0)) ||
+			((strcmp(cInFormat, "text") != 0) && (strcmp(cInFormat, "text-def") != 0) && (strcmp(cInFormat, "binary") != 0) && (strcmp(cInFormat, "pace") != 0)) ||
+			((strcmp(cOutFormat, "gml") != 0) && (strcmp(cOutFormat, "htd") != 0)) ||
+			(iDeadline < 0) || (lSize < 0) || (lSize > SRV_MAX_INPUT))
+			writeErrorMsg("Illegal request header.", "Server::handleRequest");
+		bOptimize = strcmp(cCommand, "optimize") == 0;
+		if((iK < 0) || ((iK == 0) && !bOptimize))
+			writeErrorMsg("Illegal hypertree-width.", "Server::handleRequest");
+
+		// Read the hypergraph into an int-aligned buffer as required by the binary format
+		cData = (char *)new int[(lSize/sizeof(int))+1];
+		if(cData == NULL)
+			writeErrorMsg("Error assigning memory.", "Server::handleRequest");
+		if(!receive(iSocket, cData, (size_t)lSize))
+			writeErrorMsg("Incomplete hypergraph.", "Server::handleRequest");
+
+		loadHypergraph(&HG, cInFormat, cData, (size_t)lSize);
+		HT = decompose(&HG, bOptimize, iK, iDeadline, &Status);
+
+		if(!Answer.open(iSocket))
+			writeErrorMsg("Error writing answer.", "Server::handleRequest");
+		Answer << Status.c_str();
+		if(HT != NULL) {
+			Answer << ' ' << HT->getHTreeWidth() << '\n';
+			if(strcmp(cOutFormat, "htd") == 0)
+				HT->writePACE(Answer, &HG);
+			else
+				HT->writeGML(Answer, &HG);
+		}
+		else
+			Answer << '\n';
+		Answer.close();
+	}
+	catch(exception &E) {
+		sendError(iSocket, E.what());
+	}
+
+	delete HT;
+	delete [] (int *)cData;
+	::close(iSocket);
+}
+
+
+void Server::runWorker()
+{
+	int iSocket;
+
+	// Errors in a request must not terminate the server
+	G_ThrowErrors = true;
+
+	while(true) {
+		{
+			unique_lock<mutex> Lock(MyMutex);
+			while(MyPending.empty() && !bMyShutdown)
+				MyCondition.wait(Lock);
+			if(MyPending.empty())
+				return;
+			iSocket = MyPending.front();
+			MyPending.pop_front();
+		}
+
+		if(G_StopSearch) {
+			sendError(iSocket, "Server is shutting down.");
+			::close(iSocket);
+		}
+		else
+			handleRequest(iSocket);
+	}
+}
+
+
+/*
+***Description***
+The method creates the socket file and accepts connections until a stop is requested (see
+G_StopSearch). The accepted connections are queued and processed by a fixed number of worker
+threads such that at most iNbrOfThreads decompositions are computed concurrently; connections
+exceeding the maximum number of waiting connections are rejected immediately. When the server
+is stopped, the running searches are stopped as well, the waiting connections are rejected, and
+the socket file is removed.
+
+INPUT:	cSocketFile: Name of the socket file
+		iNbrOfThreads: Number of worker threads
+OUTPUT: -
+*/
+
+void Server::run(const char *cSocketFile, int iNbrOfThreads)
+{
+	int i, iSocket;
+	struct pollfd Listener;
+	vector<thread> Workers;
+
+	listen(cSocketFile);
+
+	// Write errors into closed connections instead of terminating the server
+	signal(SIGPIPE, SIG_IGN);
+
+	for(i=0; i < iNbrOfThreads; i++)
+		Workers.push_back(thread(&Server::runWorker, this));
+
+	Listener.fd = iMyListener;
+	Listener.events = POLLIN;
+	while(!G_StopSearch) {
+		// Wake up regularly to check whether a stop was requested
+		if(poll(&Listener, 1, 200) <= 0)
+			continue;
+		if((iSocket = accept(iMyListener, NULL, NULL)) < 0)
+			continue;
+
+		MyMutex.lock();
+		if((int)MyPending.size() >= iMyMaxPending) {
+			MyMutex.unlock();
+			sendError(iSocket, "Server is busy.");
+			::close(iSocket);
+			continue;
+		}
+		MyPending.push_back(iSocket);
+		MyMutex.unlock();
+		MyCondition.notify_one();
+	}
+
+	MyMutex.lock();
+	bMyShutdown = true;
+	MyMutex.unlock();
+	MyCondition.notify_all();
+	for(i=0; i < iNbrOfThreads; i++)
+		Workers[i].join();
+
+	::close(iMyListener);
+	unlink(MySocketFile.c_str());
+}
+
+#else
+
+void Server::run(const char *cSocketFile, int iNbrOfThreads)
+{
+	writeErrorMsg("Unix domain sockets are not supported on this system.", "Server::run");
+}
+
+#endif
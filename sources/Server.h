@@ -0,0 +1,90 @@
+// Models a decomposition server that answers requests over a Unix domain socket by a fixed pool of
+// worker threads.
+//
+// Each connection carries one request: a header line
+//   "<command> <k> <deadline> <input format> <output format> <size>\n"
+// followed by <size> bytes of hypergraph data. The command is "decomp" (search for a decomposition
+// of width at most k) or "optimize" (search for a decomposition of minimal width, at most k if
+// k > 0), the deadline is given in milliseconds (0 if unlimited), the input format is "text", "text-def"
+// (text format with checked definitions), "binary", or "pace", and the output format is "gml" or
+// "htd". The server answers with a status line "found <width>", "stopped <width>" (heuristic
+// decomposition after the deadline), "not_found", or "error <message>" followed by the decomposition
+// (if any) and closes the connection.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_SERVER)
+#define CLS_SERVER
+
+#include <string>
+#include <list>
+#include <mutex>
+#include <condition_variable>
+
+using namespace std;
+
+
+#define SRV_MAX_HEADER 256  // Maximum length of a request header
+#define SRV_MAX_INPUT (1 << 30)  // Maximum size of a hypergraph in a request
+#define SRV_MAX_PENDING 64  // Default maximum number of connections waiting for a worker
+#define SRV_RECV_TIMEOUT 10  // Seconds after which a client that does not send its request is dropped
+
+
+class Hypergraph;
+class FlatHypertree;
+
+class Server
+{
+private:
+	// Listening socket and its name in the file system
+	int iMyListener;
+	string MySocketFile;
+
+	// Accepted connections waiting for a worker
+	list<int> MyPending;
+
+	// Maximum number of waiting connections; further connections are rejected
+	int iMyMaxPending;
+
+	// Indicates whether the workers shall terminate
+	bool bMyShutdown;
+
+	// Protects MyPending and bMyShutdown
+	mutex MyMutex;
+	condition_variable MyCondition;
+
+	// Seed of the random number generator for each request
+	unsigned int iMySeed;
+
+	// Creates the listening socket
+	void listen(const char *cSocketFile);
+
+	// Reads the hypergraph of a request
+	void loadHypergraph(Hypergraph *HGraph, const char *cFormat, const char *cData, size_t iSize);
+
+	// Searches for a decomposition as given by the command of a request
+	FlatHypertree *decompose(Hypergraph *HGraph, bool bOptimize, int iK, int iDeadline, string *Status);
+
+	// Reads a request from a connection, processes it, and writes the answer
+	void handleRequest(int iSocket);
+
+	// Writes an error answer
+	void sendError(int iSocket, const string &Message);
+
+	// Processes connections until the server is shut down
+	void runWorker();
+
+public:
+	// Constructor
+	Server(int iMaxPending, unsigned int iSeed);
+
+	// Destructor
+	virtual ~Server();
+
+	// Accepts connections on a socket file and processes them by iNbrOfThreads workers until a stop is requested
+	void run(const char *cSocketFile, int iNbrOfThreads);
+};
+
+
+#endif // !defined(CLS_SERVER)
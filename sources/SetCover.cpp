@@ -61,13 +61,14 @@ CompSet *SetCover::NodeCover1(CompSet *Nodes, CompSet *HEdges, bool bDeterm)
 		// Check whether there is only one hyperedge that covers the node
 		HEdge = NULL;
 		for(j=0; j < ((Node *)((*Nodes)[i]))->getNbrOfEdges(); j++)
-			if(((Node *)((*Nodes)[i]))->getEdge(j)->getLabel() != -1)
+			if(((Node *)((*Nodes)[i]))->getEdge(j)->getLabel() != -1) {
 				if(HEdge != NULL) {
 					HEdge = NULL;
 					break;
 				}
 				else
 					HEdge = ((Node *)((*Nodes)[i]))->getEdge(j);
+			}
 		
 		if((((*Nodes)[i])->getLabel() == 0) && (HEdge != NULL)) {
 			++iNbrOfCovEdges;
@@ -119,7 +120,7 @@ CompSet *SetCover::NodeCover1(CompSet *Nodes, CompSet *HEdges, bool bDeterm)
 					iMaxPos = CovCand[i];
 		}
 		else
-			iMaxPos = CovCand[rand()%CovCand.size()];
+			iMaxPos = CovCand[random_next()%CovCand.size()];
 		CovCand.clear();
 
 		++iNbrOfCovEdges;
@@ -191,13 +192,14 @@ CompSet *SetCover::NodeCover2(CompSet *Nodes, CompSet *HEdges, bool bDeterm)
 		// Check whether there is only one hyperedge that covers the node
 		HEdge = NULL;
 		for(j=0; j < ((Node *)((*Nodes)[i]))->getNbrOfEdges(); j++)
-			if(((Node *)((*Nodes)[i]))->getEdge(j)->getLabel() != -1)
+			if(((Node *)((*Nodes)[i]))->getEdge(j)->getLabel() != -1) {
 				if(HEdge != NULL) {
 					HEdge = NULL;
 					break;
 				}
 				else
 					HEdge = ((Node *)((*Nodes)[i]))->getEdge(j);
+			}
 		
 		if((((*Nodes)[i])->getLabel() == 0) && (HEdge != NULL)) {
 			++iNbrOfCovEdges;
@@ -248,7 +250,7 @@ CompSet *SetCover::NodeCover2(CompSet *Nodes, CompSet *HEdges, bool bDeterm)
 					iMaxPos = CovCand[i];
 		}
 		else
-			iMaxPos = CovCand[rand()%CovCand.size()];
+			iMaxPos = CovCand[random_next()%CovCand.size()];
 		CovCand.clear();
 
 		++iNbrOfCovEdges;
@@ -0,0 +1,240 @@
+// SymbolTable.cpp: implementation of the SymbolTable class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <cstring>
+
+#include "SymbolTable.h"
+#include "Globals.h"
+#include "MemoryAccount.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+SymbolTable::SymbolTable()
+{
+	int i;
+
+	cMyBlockPos = NULL;
+	iMyBlockFree = 0;
+
+	iMySize = ST_INIT_SIZE;
+	iMyNbrOfEntries = 0;
+	lMyBytes = 0;
+	MyNames = new char*[iMySize];
+	MyHashes = new unsigned int[iMySize];
+	MySpaces = new int[iMySize];
+	MyValues = new int[iMySize];
+	if((MyNames == NULL) || (MyHashes == NULL) || (MySpaces == NULL) || (MyValues == NULL))
+		writeErrorMsg("Error assigning memory.", "SymbolTable::SymbolTable");
+	for(i=0; i < iMySize; i++)
+		MyNames[i] = NULL;
+	account((long long)iMySize*(sizeof(char *)+sizeof(unsigned int)+2*sizeof(int)));
+}
+
+
+SymbolTable::~SymbolTable()
+{
+	list<char *>::iterator BlockIter;
+
+	for(BlockIter=MyBlocks.begin(); BlockIter != MyBlocks.end(); BlockIter++)
+		delete [] *BlockIter;
+
+	delete [] MyNames;
+	delete [] MyHashes;
+	delete [] MySpaces;
+	delete [] MyValues;
+
+	MemoryAccount::sub(MEM_PARSER, lMyBytes);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method computes the FNV-1a hash value of an identifier. The hash value does not depend on
+the name space such that all entries of the same identifier are found on the same probe sequence.
+
+INPUT:	cName: Identifier (not necessarily terminated by '\0')
+		iLength: Length of the identifier
+OUTPUT: return: Hash value
+*/
+
+unsigned int SymbolTable::hash(const char *cName, int iLength)
+{
+	unsigned int iHash = 2166136261u;
+
+	for(int i=0; i < iLength; i++) {
+		iHash ^= (unsigned char)cName[i];
+		iHash *= 16777619u;
+	}
+
+	return iHash;
+}
+
+
+/*
+***Description***
+The method copies an identifier into the string arena. The arena grows in blocks such that
+the addresses of identifiers already stored remain valid.
+
+INPUT:	cName: Identifier (not necessarily terminated by '\0')
+		iLength: Length of the identifier
+OUTPUT: return: Copy of the identifier terminated by '\0'
+*/
+
+char *SymbolTable::store(const char *cName, int iLength)
+{
+	char *cCopy;
+	int iBlockSize;
+
+	if(iLength+1 > iMyBlockFree) {
+		iBlockSize = iLength+1 > ST_BLOCK_SIZE ? iLength+1 : ST_BLOCK_SIZE;
+		cMyBlockPos = new char[iBlockSize];
+		if(cMyBlockPos == NULL)
+			writeErrorMsg("Error assigning memory.", "SymbolTable::store");
+		MyBlocks.push_back(cMyBlockPos);
+		iMyBlockFree = iBlockSize;
+		account(iBlockSize);
+	}
+
+	cCopy = cMyBlockPos;
+	memcpy(cCopy, cName, iLength);
+	cCopy[iLength] = '\0';
+	cMyBlockPos += iLength+1;
+	iMyBlockFree -= iLength+1;
+
+	return cCopy;
+}
+
+
+/*
+***Description***
+The method doubles the number of slots in the hash table and reinserts all entries.
+*/
+
+void SymbolTable::grow()
+{
+	int iOldSize = iMySize, iPos, i;
+	char **OldNames = MyNames;
+	unsigned int *OldHashes = MyHashes;
+	int *OldSpaces = MySpaces, *OldValues = MyValues;
+
+	iMySize *= 2;
+	MyNames = new char*[iMySize];
+	MyHashes = new unsigned int[iMySize];
+	MySpaces = new int[iMySize];
+	MyValues = new int[iMySize];
+	if((MyNames == NULL) || (MyHashes == NULL) || (MySpaces == NULL) || (MyValues == NULL))
+		writeErrorMsg("Error assigning memory.", "SymbolTable::grow");
+	for(i=0; i < iMySize; i++)
+		MyNames[i] = NULL;
+
+	// Reinsert all entries
+	for(i=0; i < iOldSize; i++)
+		if(OldNames[i] != NULL) {
+			for(iPos=OldHashes[i] & (iMySize-1); MyNames[iPos] != NULL; iPos=(iPos+1) & (iMySize-1));
+			MyNames[iPos] = OldNames[i];
+			MyHashes[iPos] = OldHashes[i];
+			MySpaces[iPos] = OldSpaces[i];
+			MyValues[iPos] = OldValues[i];
+		}
+
+	delete [] OldNames;
+	delete [] OldHashes;
+	delete [] OldSpaces;
+	delete [] OldValues;
+
+	// The new arrays are twice as large as the old ones
+	account((long long)iOldSize*(sizeof(char *)+sizeof(unsigned int)+2*sizeof(int)));
+}
+
+
+void SymbolTable::account(long long lBytes)
+{
+	lMyBytes += lBytes;
+	MemoryAccount::add(MEM_PARSER, lBytes);
+}
+
+
+/*
+***Description***
+The method searches for an identifier in a given name space.
+
+INPUT:	iSpace: Name space
+		cName: Identifier (not necessarily terminated by '\0')
+		iLength: Length of the identifier
+OUTPUT: return: Value stored with the identifier; -1 if the identifier is not contained
+*/
+
+int SymbolTable::find(int iSpace, const char *cName, int iLength)
+{
+	int iPos;
+	unsigned int iHash = hash(cName, iLength);
+
+	for(iPos=iHash & (iMySize-1); MyNames[iPos] != NULL; iPos=(iPos+1) & (iMySize-1))
+		if((MyHashes[iPos] == iHash) && (MySpaces[iPos] == iSpace) && 
+			(strncmp(MyNames[iPos], cName, iLength) == 0) && (MyNames[iPos][iLength] == '\0'))
+			return MyValues[iPos];
+
+	return -1;
+}
+
+
+/*
+***Description***
+The method inserts an identifier into a given name space. If the identifier is already 
+contained in some other name space, its interned string is shared; otherwise the identifier 
+is copied into the string arena. It is assumed that the identifier is not yet contained in 
+the given name space.
+
+INPUT:	iSpace: Name space
+		cName: Identifier (not necessarily terminated by '\0')
+		iLength: Length of the identifier
+		iValue: Value to be stored with the identifier (non-negative)
+OUTPUT: return: Interned identifier terminated by '\0'
+*/
+
+char *SymbolTable::insert(int iSpace, const char *cName, int iLength, int iValue)
+{
+	int iPos;
+	char *cInterned = NULL;
+	unsigned int iHash;
+
+	if(2*(iMyNbrOfEntries+1) > iMySize)
+		grow();
+
+	// Search for a free slot and for an interned copy of the identifier
+	iHash = hash(cName, iLength);
+	for(iPos=iHash & (iMySize-1); MyNames[iPos] != NULL; iPos=(iPos+1) & (iMySize-1))
+		if((cInterned == NULL) && (MyHashes[iPos] == iHash) && 
+			(strncmp(MyNames[iPos], cName, iLength) == 0) && (MyNames[iPos][iLength] == '\0'))
+			cInterned = MyNames[iPos];
+
+	if(cInterned == NULL)
+		cInterned = store(cName, iLength);
+
+	MyNames[iPos] = cInterned;
+	MyHashes[iPos] = iHash;
+	MySpaces[iPos] = iSpace;
+	MyValues[iPos] = iValue;
+	++iMyNbrOfEntries;
+
+	return cInterned;
+}
+
+
+int SymbolTable::getNbrOfEntries()
+{
+	return iMyNbrOfEntries;
+}
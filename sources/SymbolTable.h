@@ -0,0 +1,71 @@
+// Models a symbol table interning identifiers into a string arena.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_SYMBOLTABLE)
+#define CLS_SYMBOLTABLE
+
+#include <list>
+
+using namespace std;
+
+
+#define ST_INIT_SIZE 1024
+#define ST_BLOCK_SIZE 65536
+
+
+class SymbolTable  
+{
+private:
+	// Blocks of the string arena in which all identifiers are stored
+	list<char *> MyBlocks;
+
+	// Next free position and number of free characters in the actual block
+	char *cMyBlockPos;
+	int iMyBlockFree;
+
+	// Open-addressing hash table (linear probing); a slot is free if its name is NULL
+	char **MyNames;
+	unsigned int *MyHashes;
+	int *MySpaces;
+	int *MyValues;
+
+	// Number of slots (a power of two) and number of occupied slots
+	int iMySize;
+	int iMyNbrOfEntries;
+
+	// Number of bytes held by the hash table and the string arena
+	long long lMyBytes;
+
+	// Computes the hash value of an identifier
+	unsigned int hash(const char *cName, int iLength);
+
+	// Copies an identifier into the string arena
+	char *store(const char *cName, int iLength);
+
+	// Doubles the number of slots in the hash table
+	void grow();
+
+	// Adds the bytes of the hash table or of a block of the string arena to the memory account
+	void account(long long lBytes);
+
+public:
+	// Constructor
+	SymbolTable();
+
+	// Destructor
+	virtual ~SymbolTable();
+
+	// Returns the value of an identifier in a given name space (-1 if it is not contained)
+	int find(int iSpace, const char *cName, int iLength);
+
+	// Inserts an identifier into a given name space and returns its interned string
+	char *insert(int iSpace, const char *cName, int iLength, int iValue);
+
+	// Returns the number of identifiers in all name spaces
+	int getNbrOfEntries();
+};
+
+
+#endif // !defined(CLS_SYMBOLTABLE)
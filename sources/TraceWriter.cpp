@@ -0,0 +1,168 @@
+// TraceWriter.cpp: implementation of the TraceWriter class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+
+using namespace std;
+
+#include "TraceWriter.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+TraceWriter::TraceWriter()
+{
+	lMyMaxEvents = 0;
+	iMyMaxLevel = -1;
+	lMyNbrOfEvents = lMyNbrOfDropped = 0;
+}
+
+
+TraceWriter::~TraceWriter()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+void TraceWriter::writeTime(long long lTime)
+{
+	char cFraction[8];
+
+	sprintf(cFraction, ".%03d", (int)(lTime % 1000));
+	MyOut << lTime / 1000 << cFraction;
+}
+
+
+/*
+***Description***
+The method writes the beginning of an event object with the fields common to all events; the
+caller completes the object. All events belong to the same process and thread.
+
+INPUT:	cName: Name of the event
+		cPhase: Type of the event ('B' begin, 'E' end, or 'X' complete span)
+		lTime: Time stamp in nanoseconds since the trace was opened
+*/
+
+void TraceWriter::writeEvent(const char *cName, char cPhase, long long lTime)
+{
+	MyOut << ((lMyNbrOfEvents > 0) ? ",\n" : "\n") << "{\"name\": \"" << cName << "\", \"cat\": \"search\", \"ph\": \"" << cPhase;
+	MyOut << "\", \"pid\": 1, \"tid\": 1, \"ts\": ";
+	writeTime(lTime);
+}
+
+
+/*
+***Description***
+The method opens the trace file and starts the array of trace events. The limits keep the file
+bounded: decomp calls below iMaxLevel are not traced at all, and once lMaxEvents events were
+written, further events are dropped (the end events of the open decomp calls are reserved, so
+the spans stay balanced).
+
+INPUT:	cNameOfFile: Name of the trace file
+		lMaxEvents: Maximum number of events (0 if unlimited)
+		iMaxLevel: Deepest traced recursion level (-1 if unlimited)
+OUTPUT: return: true if the file was opened; otherwise false
+*/
+
+bool TraceWriter::open(const char *cNameOfFile, long long lMaxEvents, int iMaxLevel)
+{
+	if(!MyOut.open(cNameOfFile))
+		return false;
+
+	lMyMaxEvents = lMaxEvents;
+	iMyMaxLevel = iMaxLevel;
+	lMyNbrOfEvents = lMyNbrOfDropped = 0;
+	MyStart = chrono::steady_clock::now();
+	MyOut << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+
+	return true;
+}
+
+
+bool TraceWriter::close()
+{
+	MyOut << "\n], \"otherData\": {\"events\": " << lMyNbrOfEvents << ", \"dropped_events\": " << lMyNbrOfDropped << "}}\n";
+
+	return MyOut.close();
+}
+
+
+long long TraceWriter::now()
+{
+	return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - MyStart).count();
+}
+
+
+/*
+***Description***
+The method starts the span of a decomp call if the limits allow it; the end event is counted
+already now such that it can always be written.
+
+INPUT:	iRecLevel: Recursion level
+		iNbrOfEdges: Number of hyperedges in the component
+		iConnSize: Number of connector nodes
+OUTPUT: return: true if the decomp call is traced (endDecomp must be called); otherwise false
+*/
+
+bool TraceWriter::beginDecomp(int iRecLevel, int iNbrOfEdges, int iConnSize)
+{
+	if((iMyMaxLevel >= 0) && (iRecLevel > iMyMaxLevel))
+		return false;
+	if((lMyMaxEvents > 0) && (lMyNbrOfEvents+2 > lMyMaxEvents)) {
+		++lMyNbrOfDropped;
+		return false;
+	}
+
+	writeEvent("decomp", 'B', now());
+	MyOut << ", \"args\": {\"level\": " << iRecLevel << ", \"edges\": " << iNbrOfEdges << ", \"connector\": " << iConnSize << "}}";
+	lMyNbrOfEvents += 2;
+
+	return true;
+}
+
+
+void TraceWriter::endDecomp(const char *cResult)
+{
+	// The end event was already counted by beginDecomp
+	writeEvent("decomp", 'E', now());
+	MyOut << ", \"args\": {\"result\": \"" << cResult << "\"}}";
+}
+
+
+void TraceWriter::writeSpan(const char *cName, long long lStart)
+{
+	long long lEnd = now();
+
+	if((lMyMaxEvents > 0) && (lMyNbrOfEvents+1 > lMyMaxEvents)) {
+		++lMyNbrOfDropped;
+		return;
+	}
+
+	writeEvent(cName, 'X', lStart);
+	MyOut << ", \"dur\": ";
+	writeTime(lEnd - lStart);
+	MyOut << "}";
+	++lMyNbrOfEvents;
+}
+
+
+long long TraceWriter::getNbrOfEvents()
+{
+	return lMyNbrOfEvents;
+}
+
+
+long long TraceWriter::getNbrOfDropped()
+{
+	return lMyNbrOfDropped;
+}
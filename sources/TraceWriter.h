@@ -0,0 +1,73 @@
+// Models a trace of the search of det-k-decomp in the Chrome trace-event format: nested spans of
+// the decomp calls and of the expensive steps within them, which can be loaded into a trace viewer
+// (e.g., chrome://tracing or Perfetto).
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_TRACEWRITER)
+#define CLS_TRACEWRITER
+
+#include <chrono>
+
+#include "FileWriter.h"
+
+using namespace std;
+
+
+class TraceWriter
+{
+private:
+	// Output file
+	FileWriter MyOut;
+
+	// Time at which the trace was opened; all time stamps are relative to it
+	chrono::steady_clock::time_point MyStart;
+
+	// Maximum number of events and deepest recursion level whose decomp calls are traced
+	long long lMyMaxEvents;
+	int iMyMaxLevel;
+
+	// Number of events written (or reserved for open decomp calls) and dropped
+	long long lMyNbrOfEvents, lMyNbrOfDropped;
+
+	// Writes the common fields of an event
+	void writeEvent(const char *cName, char cPhase, long long lTime);
+
+	// Writes a time in nanoseconds as microseconds with three decimals
+	void writeTime(long long lTime);
+
+public:
+	// Constructor
+	TraceWriter();
+
+	// Destructor
+	virtual ~TraceWriter();
+
+	// Opens the trace file; returns false if the file cannot be opened
+	bool open(const char *cNameOfFile, long long lMaxEvents, int iMaxLevel);
+
+	// Terminates the trace and closes the file; returns false if writing failed
+	bool close();
+
+	// Returns the nanoseconds elapsed since the trace was opened
+	long long now();
+
+	// Starts the span of a decomp call; returns false if the call is not traced
+	bool beginDecomp(int iRecLevel, int iNbrOfEdges, int iConnSize);
+
+	// Ends the span of the innermost traced decomp call
+	void endDecomp(const char *cResult);
+
+	// Writes a span from lStart (see now) until now
+	void writeSpan(const char *cName, long long lStart);
+
+	// Returns the number of events written
+	long long getNbrOfEvents();
+
+	// Returns the number of events dropped because of the limits
+	long long getNbrOfDropped();
+};
+
+
+#endif // !defined(CLS_TRACEWRITER)
@@ -0,0 +1,305 @@
+// Verifier.cpp: implementation of the Verifier class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <algorithm>
+#include <thread>
+
+using namespace std;
+
+#include "Verifier.h"
+#include "Hypergraph.h"
+#include "Hypertree.h"
+#include "FlatHypertree.h"
+#include "Hyperedge.h"
+#include "Node.h"
+#include "Globals.h"
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+Verifier::Verifier(int iNbrOfThreads)
+{
+	MyHGraph = NULL;
+	MyFTree = NULL;
+	MyOwnFTree = NULL;
+	iMyNbrOfThreads = iNbrOfThreads > 0 ? iNbrOfThreads : 1;
+}
+
+
+Verifier::~Verifier()
+{
+	delete MyOwnFTree;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method indexes a flat hypertree, whose nodes are numbered in preorder such that each 
+subtree is an interval of positions: the end positions of the subtrees are computed, and for 
+each node of the hypergraph the positions of the chi-sets containing it are collected in 
+ascending order. The nodes and hyperedges of the hypergraph are labeled by their positions; 
+these labels must not be changed until the conditions are checked.
+
+INPUT:	HGraph: Hypergraph
+		FTree: Flat hypertree
+*/
+
+void Verifier::index(Hypergraph *HGraph, FlatHypertree *FTree)
+{
+	int iNbrOfNodes, iNbrOfTNodes, t, i;
+
+	MyHGraph = HGraph;
+	MyFTree = FTree;
+	iNbrOfNodes = HGraph->getNbrOfNodes();
+	iNbrOfTNodes = FTree->getNbrOfNodes();
+	for(i=0; i < iNbrOfNodes; i++)
+		HGraph->getNode(i)->setLabel(i);
+	for(i=0; i < HGraph->getNbrOfEdges(); i++)
+		HGraph->getEdge(i)->setLabel(i);
+
+	// Compute the ends of the subtrees bottom-up
+	MyEnds.resize(iNbrOfTNodes);
+	for(t=iNbrOfTNodes-1; t >= 0; t--)
+		MyEnds[t] = t+1;
+	for(t=iNbrOfTNodes-1; t > 0; t--)
+		MyEnds[FTree->getParent(t)] = max(MyEnds[FTree->getParent(t)], MyEnds[t]);
+
+	// Distribute the positions of the hypertree nodes to the nodes of their chi-sets by counting sort
+	MyOccStart.assign(iNbrOfNodes+1, 0);
+	for(t=0; t < iNbrOfTNodes; t++)
+		for(i=0; i < FTree->getChiSize(t); i++)
+			++MyOccStart[FTree->getChi(t)[i]+1];
+	for(i=0; i < iNbrOfNodes; i++)
+		MyOccStart[i+1] += MyOccStart[i];
+	MyOccs.resize(MyOccStart[iNbrOfNodes]);
+	for(t=0; t < iNbrOfTNodes; t++)
+		for(i=0; i < FTree->getChiSize(t); i++)
+			MyOccs[MyOccStart[FTree->getChi(t)[i]]++] = t;
+	for(i=iNbrOfNodes; i > 0; i--)
+		MyOccStart[i] = MyOccStart[i-1];
+	MyOccStart[0] = 0;
+}
+
+
+/*
+***Description***
+The method indexes a hypertree by flattening it in a single traversal; the hypertree nodes 
+are kept in preorder such that violating hypertree nodes can be returned. It is assumed that 
+the hypertree is acyclic.
+
+INPUT:	HGraph: Hypergraph
+		HTree: Root of the hypertree
+*/
+
+void Verifier::index(Hypergraph *HGraph, Hypertree *HTree)
+{
+	delete MyOwnFTree;
+	MyOwnFTree = new FlatHypertree(HGraph, HTree, &MyTNodes);
+	if(MyOwnFTree == NULL)
+		writeErrorMsg("Error assigning memory.", "Verifier::index");
+
+	index(HGraph, MyOwnFTree);
+}
+
+
+Hypertree *Verifier::getTNode(int t)
+{
+	return MyTNodes[t];
+}
+
+
+bool Verifier::occurs(int v, int iFrom, int iTo)
+{
+	vector<int>::iterator OccIter;
+
+	OccIter = lower_bound(MyOccs.begin()+MyOccStart[v], MyOccs.begin()+MyOccStart[v+1], iFrom);
+	return (OccIter != MyOccs.begin()+MyOccStart[v+1]) && (*OccIter < iTo);
+}
+
+
+/*
+***Description***
+The method checks a hypertree condition for a range of items and stops at the first violation.
+The items are the hyperedges for condition 1, the nodes for condition 2, and the positions of 
+the hypertree nodes for conditions 3 and 4:
+1. A hyperedge is covered if all its nodes occur at some position at which its node with the 
+   fewest occurrences occurs.
+2. The occurrences of a node are connected iff exactly one of them has no parent containing it.
+3. The nodes of the lambda-set are marked in an array of time stamps (which need not be reset
+   between hypertree nodes); all nodes in the chi-set must be marked.
+4. The chi-set is marked; each unmarked node of the lambda-set must not occur in the interval
+   of the subtree.
+The index is only read such that several ranges can be checked concurrently.
+
+INPUT:	iCond: Number of the condition (1-4)
+		iFrom: First item
+		iTo: Item after the last item
+OUTPUT: Witness: First violating item; -1 if the condition is satisfied by all items
+*/
+
+void Verifier::checkRange(int iCond, int iFrom, int iTo, int *Witness)
+{
+	int iNbrOfNodes, iOcc, iTops, u, v, t, p, i, j, l;
+	vector<int> Stamps;
+	const uint32_t *Chi, *Lambda;
+	Hyperedge *Edge;
+
+	*Witness = -1;
+	if((iCond == 3) || (iCond == 4))
+		Stamps.assign(MyHGraph->getNbrOfNodes(), -1);
+
+	for(i=iFrom; i < iTo; i++)
+		switch(iCond) {
+			case 1:
+				// Select the node of the hyperedge with the fewest occurrences
+				Edge = MyHGraph->getEdge(i);
+				iNbrOfNodes = Edge->getNbrOfNodes();
+				if(iNbrOfNodes == 0)
+					break;
+				for(u=Edge->getNode(0)->getLabel(), j=1; j < iNbrOfNodes; j++) {
+					v = Edge->getNode(j)->getLabel();
+					if(MyOccStart[v+1]-MyOccStart[v] < MyOccStart[u+1]-MyOccStart[u])
+						u = v;
+				}
+
+				// Search for a chi-set containing the node and all other nodes of the hyperedge
+				for(iOcc=MyOccStart[u]; iOcc < MyOccStart[u+1]; iOcc++) {
+					t = MyOccs[iOcc];
+					for(j=0; j < iNbrOfNodes; j++)
+						if(!occurs(Edge->getNode(j)->getLabel(), t, t+1))
+							break;
+					if(j >= iNbrOfNodes)
+						break;
+				}
+				if(iOcc >= MyOccStart[u+1]) {
+					*Witness = i;
+					return;
+				}
+				break;
+
+			case 2:
+				// Count the occurrences whose parents do not contain the node
+				iTops = 0;
+				for(j=MyOccStart[i]; j < MyOccStart[i+1]; j++) {
+					p = MyFTree->getParent(MyOccs[j]);
+					if((p < 0) || !occurs(i, p, p+1))
+						++iTops;
+				}
+				if(iTops > 1) {
+					*Witness = i;
+					return;
+				}
+				break;
+
+			case 3:
+				Lambda = MyFTree->getLambda(i);
+				for(l=0; l < MyFTree->getLambdaSize(i); l++) {
+					Edge = MyHGraph->getEdge(Lambda[l]);
+					for(j=0; j < Edge->getNbrOfNodes(); j++)
+						Stamps[Edge->getNode(j)->getLabel()] = i;
+				}
+				Chi = MyFTree->getChi(i);
+				for(j=0; j < MyFTree->getChiSize(i); j++)
+					if(Stamps[Chi[j]] != i) {
+						*Witness = i;
+						return;
+					}
+				break;
+
+			case 4:
+				Chi = MyFTree->getChi(i);
+				for(j=0; j < MyFTree->getChiSize(i); j++)
+					Stamps[Chi[j]] = i;
+				Lambda = MyFTree->getLambda(i);
+				for(l=0; l < MyFTree->getLambdaSize(i); l++) {
+					Edge = MyHGraph->getEdge(Lambda[l]);
+					for(j=0; j < Edge->getNbrOfNodes(); j++) {
+						v = Edge->getNode(j)->getLabel();
+						if((Stamps[v] != i) && occurs(v, i+1, MyEnds[i])) {
+							*Witness = i;
+							return;
+						}
+					}
+				}
+				break;
+		}
+}
+
+
+/*
+***Description***
+The method checks a hypertree condition for all items. The items are divided into consecutive
+blocks of at least VER_MIN_BLOCK items that are checked by separate threads; the first violating
+item of the first block containing a violation is returned such that the result does not depend
+on the number of threads.
+
+INPUT:	iCond: Number of the condition (1-4)
+		iNbrOfItems: Number of items
+OUTPUT: return: First violating item; -1 if the condition is satisfied by all items
+*/
+
+int Verifier::check(int iCond, int iNbrOfItems)
+{
+	int iNbrOfBlocks, i;
+	vector<int> Witnesses;
+	vector<thread> Workers;
+
+	iNbrOfBlocks = min(iMyNbrOfThreads, max(1, iNbrOfItems / VER_MIN_BLOCK));
+	Witnesses.resize(iNbrOfBlocks);
+	if(iNbrOfBlocks == 1) {
+		checkRange(iCond, 0, iNbrOfItems, &Witnesses[0]);
+		return Witnesses[0];
+	}
+
+	for(i=0; i < iNbrOfBlocks; i++)
+		Workers.push_back(thread(&Verifier::checkRange, this, iCond, (int)((long long)iNbrOfItems*i/iNbrOfBlocks), 
+			(int)((long long)iNbrOfItems*(i+1)/iNbrOfBlocks), &Witnesses[i]));
+	for(i=0; i < iNbrOfBlocks; i++)
+		Workers[i].join();
+
+	for(i=0; i < iNbrOfBlocks; i++)
+		if(Witnesses[i] >= 0)
+			return Witnesses[i];
+
+	return -1;
+}
+
+
+Hyperedge *Verifier::checkCond1()
+{
+	int iWitness = check(1, MyHGraph->getNbrOfEdges());
+
+	return iWitness < 0 ? NULL : MyHGraph->getEdge(iWitness);
+}
+
+
+Node *Verifier::checkCond2()
+{
+	int iWitness = check(2, MyHGraph->getNbrOfNodes());
+
+	return iWitness < 0 ? NULL : MyHGraph->getNode(iWitness);
+}
+
+
+int Verifier::checkCond3()
+{
+	return check(3, MyFTree->getNbrOfNodes());
+}
+
+
+int Verifier::checkCond4()
+{
+	return check(4, MyFTree->getNbrOfNodes());
+}
@@ -0,0 +1,88 @@
+// Models a verifier of the hypertree conditions that indexes a hypertree once and checks each
+// condition in time near-linear in the size of the decomposition.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_VERIFIER)
+#define CLS_VERIFIER
+
+#include <vector>
+
+using namespace std;
+
+
+class Hypergraph;
+class Hypertree;
+class FlatHypertree;
+class Hyperedge;
+class Node;
+
+// Minimum number of items (hyperedges, nodes, or hypertree nodes) checked by each thread
+#define VER_MIN_BLOCK 4096
+
+class Verifier
+{
+private:
+	// Underlying hypergraph
+	Hypergraph *MyHGraph;
+
+	// Maximum number of threads checking a condition
+	int iMyNbrOfThreads;
+
+	// Indexed hypertree, and the hypertree flattened by the verifier if a Hypertree was indexed
+	FlatHypertree *MyFTree, *MyOwnFTree;
+
+	// Hypertree nodes in preorder if a Hypertree was indexed
+	vector<Hypertree *> MyTNodes;
+
+	// End positions of the subtrees (the subtree of position t consists of the positions t, ...,
+	// MyEnds[t]-1)
+	vector<int> MyEnds;
+
+	// Occurrences of the nodes in the chi-sets; the positions of the hypertree nodes whose chi-set
+	// contains node v are MyOccs[MyOccStart[v]], ..., MyOccs[MyOccStart[v+1]-1] in ascending order
+	vector<int> MyOccStart, MyOccs;
+
+	// Checks whether node v occurs in the chi-set of some hypertree node at positions iFrom, ..., iTo-1
+	bool occurs(int v, int iFrom, int iTo);
+
+	// Checks a condition for the items iFrom, ..., iTo-1 and stores the first violating item (-1 if none)
+	void checkRange(int iCond, int iFrom, int iTo, int *Witness);
+
+	// Checks a condition for all items in parallel and returns the first violating item (-1 if none)
+	int check(int iCond, int iNbrOfItems);
+
+public:
+	// Constructor
+	Verifier(int iNbrOfThreads = 1);
+
+	// Destructor
+	virtual ~Verifier();
+
+	// Indexes a flat hypertree over a hypergraph (the labels of the nodes and hyperedges are overwritten)
+	void index(Hypergraph *HGraph, FlatHypertree *FTree);
+
+	// Indexes a hypertree over a hypergraph (the labels of the nodes and hyperedges are overwritten)
+	void index(Hypergraph *HGraph, Hypertree *HTree);
+
+	// Returns the hypertree node at a position in preorder if a Hypertree was indexed
+	Hypertree *getTNode(int t);
+
+	// Checks hypertree condition 1 (each hyperedge is covered by some chi-set)
+	Hyperedge *checkCond1();
+
+	// Checks hypertree condition 2 (connectedness of the occurrences of each node)
+	Node *checkCond2();
+
+	// Checks hypertree condition 3 (each chi-set is covered by the lambda-set) and returns the
+	// position of a violating hypertree node (-1 if none)
+	int checkCond3();
+
+	// Checks hypertree condition 4 (special condition) and returns the position of a violating
+	// hypertree node (-1 if none)
+	int checkCond4();
+};
+
+
+#endif // !defined(CLS_VERIFIER)
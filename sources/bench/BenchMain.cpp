@@ -0,0 +1,124 @@
+// Benchmark driver of det-k-decomp: decomposes the instances of a suite for several seeds and
+// repetitions, writes the results as CSV or JSON file, and compares them with a baseline.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include "Benchmark.h"
+
+
+void usage(char *cProgram)
+{
+	cerr << "Usage: " << cProgram << " [--suite <file>] [--k <k> | --optimize] [--seeds <n>,<n>,...] [--reps <n>] [--deadline <sec>]" << endl;
+	cerr << "       " << string(strlen(cProgram), ' ') << " [-j <threads>] [--out <file>] [--baseline <file> [--threshold <percent>] [--alpha <p>]] [<instance> ...]" << endl;
+	exit(EXIT_FAILURE);
+}
+
+
+// Converts a positive integer argument; exits if the argument is illegal
+int parsePositive(const char *cOption, char *cArg)
+{
+	char *cEnd;
+	long iValue = strtol(cArg, &cEnd, 10);
+
+	if((*cEnd != '\0') || (iValue < 1)) {
+		cerr << "Illegal argument " << cOption << " " << cArg << "." << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	return (int)iValue;
+}
+
+
+int main(int argc, char **argv)
+{
+	int iK = -1, iNbrOfSlower, i;
+	double rThreshold = 0.05, rAlpha = 0.05;
+	char *cSuiteFile = NULL, *cOutFile = NULL, *cBaselineFile = NULL, *cSeed;
+	vector<unsigned int> Seeds;
+	vector<BenchRun> Baseline;
+	Benchmark Bench;
+
+	for(i=1; (i < argc) && (argv[i][0] == '-'); i++)
+		if((strcmp(argv[i], "--suite") == 0) && (i+1 < argc))
+			cSuiteFile = argv[++i];
+		else if((strcmp(argv[i], "--k") == 0) && (i+1 < argc)) {
+			iK = parsePositive("--k", argv[i+1]);
+			++i;
+		}
+		else if(strcmp(argv[i], "--optimize") == 0)
+			iK = 0;
+		else if((strcmp(argv[i], "--seeds") == 0) && (i+1 < argc)) {
+			for(cSeed=strtok(argv[++i], ","); cSeed != NULL; cSeed=strtok(NULL, ","))
+				Seeds.push_back((unsigned int)parsePositive("--seeds", cSeed));
+			if(Seeds.empty())
+				usage(argv[0]);
+			Bench.setSeeds(Seeds);
+		}
+		else if((strcmp(argv[i], "--reps") == 0) && (i+1 < argc)) {
+			Bench.setReps(parsePositive("--reps", argv[i+1]));
+			++i;
+		}
+		else if((strcmp(argv[i], "--deadline") == 0) && (i+1 < argc)) {
+			Bench.setDeadline(parsePositive("--deadline", argv[i+1]));
+			++i;
+		}
+		else if((strcmp(argv[i], "-j") == 0) && (i+1 < argc)) {
+			Bench.setThreads(parsePositive("-j", argv[i+1]));
+			++i;
+		}
+		else if((strcmp(argv[i], "--out") == 0) && (i+1 < argc))
+			cOutFile = argv[++i];
+		else if((strcmp(argv[i], "--baseline") == 0) && (i+1 < argc))
+			cBaselineFile = argv[++i];
+		else if((strcmp(argv[i], "--threshold") == 0) && (i+1 < argc))
+			rThreshold = atof(argv[++i]) / 100;
+		else if((strcmp(argv[i], "--alpha") == 0) && (i+1 < argc))
+			rAlpha = atof(argv[++i]);
+		else
+			usage(argv[0]);
+
+	// Instances are given by the suite file and the remaining arguments
+	if(cSuiteFile != NULL)
+		Bench.readSuite(cSuiteFile);
+	for(; i < argc; i++) {
+		if(iK < 0) {
+			cerr << "Instances on the command line require --k or --optimize." << endl;
+			exit(EXIT_FAILURE);
+		}
+		Bench.addInstance(argv[i], iK);
+	}
+	if(Bench.getNbrOfInstances() == 0)
+		usage(argv[0]);
+	if(iK >= 0)
+		Bench.setWidth(iK);
+
+	// Read the baseline first such that an illegal file is detected before running the suite
+	if(cBaselineFile != NULL)
+		Benchmark::readResults(cBaselineFile, &Baseline);
+
+	Bench.run(true);
+	if(cOutFile != NULL) {
+		Bench.writeResults(cOutFile);
+		cout << endl << "Results written to: " << cOutFile << endl;
+	}
+
+	if(cBaselineFile != NULL) {
+		cout << endl << "Comparison with " << cBaselineFile << " (search times):" << endl;
+		iNbrOfSlower = Bench.compare(&Baseline, rThreshold, rAlpha, cout);
+		if(iNbrOfSlower > 0) {
+			cout << endl << iNbrOfSlower << " instance(s) significantly slower." << endl;
+			return EXIT_FAILURE;
+		}
+	}
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,548 @@
+// Benchmark.cpp: implementation of the Benchmark class.
+//
+//////////////////////////////////////////////////////////////////////
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <chrono>
+#include <stdexcept>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/resource.h>
+#include <sys/wait.h>
+
+using namespace std;
+
+#include "Benchmark.h"
+#include "../Decomposer.h"
+#include "../FileWriter.h"
+#include "../Globals.h"
+
+
+// Header line of the CSV results
+#define BENCH_CSV_HEADER "instance,mode,seed,rep,status,width,load_ns,decomp_ns,wall_ns,decomp_calls,separators,pruned_components,peak_rss_kb"
+
+
+/*
+***Description***
+The function evaluates the continued fraction of the incomplete beta function by the modified
+Lentz method (see Press et al., Numerical Recipes, Section 6.4).
+
+INPUT:	a, b: Parameters of the beta function
+		x: Argument in [0, 1]
+OUTPUT: return: Value of the continued fraction
+*/
+
+static double betaFraction(double a, double b, double x)
+{
+	int m;
+	double c = 1, d, h, rDelta, rAux;
+
+	d = 1 - (a+b) * x / (a+1);
+	if(fabs(d) < 1e-30)
+		d = 1e-30;
+	d = 1 / d;
+	h = d;
+	for(m=1; m <= 200; m++) {
+		// Even step
+		rAux = m * (b-m) * x / ((a+2*m-1) * (a+2*m));
+		d = 1 + rAux * d;
+		c = 1 + rAux / c;
+		if(fabs(d) < 1e-30)
+			d = 1e-30;
+		if(fabs(c) < 1e-30)
+			c = 1e-30;
+		d = 1 / d;
+		h *= d * c;
+
+		// Odd step
+		rAux = -(a+m) * (a+b+m) * x / ((a+2*m) * (a+2*m+1));
+		d = 1 + rAux * d;
+		c = 1 + rAux / c;
+		if(fabs(d) < 1e-30)
+			d = 1e-30;
+		if(fabs(c) < 1e-30)
+			c = 1e-30;
+		d = 1 / d;
+		rDelta = d * c;
+		h *= rDelta;
+		if(fabs(rDelta-1) < 1e-12)
+			break;
+	}
+
+	return h;
+}
+
+
+/*
+***Description***
+The function returns the probability that a Student t-distributed random variable with rDF
+degrees of freedom exceeds t, computed by the regularized incomplete beta function.
+
+INPUT:	t: Value of the test statistic
+		rDF: Degrees of freedom
+OUTPUT: return: One-sided p-value P(T > t)
+*/
+
+static double studentTail(double t, double rDF)
+{
+	double x = rDF / (rDF + t*t), a = rDF / 2, b = 0.5, rBeta, rP;
+
+	rBeta = exp(lgamma(a+b) - lgamma(a) - lgamma(b) + a*log(x) + b*log(1-x));
+	if(x < (a+1) / (a+b+2))
+		rP = rBeta * betaFraction(a, b, x) / a;
+	else
+		rP = 1 - rBeta * betaFraction(b, a, 1-x) / b;
+
+	// rP is the probability of |T| > |t|
+	return t > 0 ? rP / 2 : 1 - rP / 2;
+}
+
+
+// Computes the mean and the sample variance of the logarithms of the search times
+static void logMoments(vector<double> &Times, double *rMean, double *rVar)
+{
+	int i;
+
+	*rMean = *rVar = 0;
+	for(i=0; i < (int)Times.size(); i++)
+		*rMean += log(Times[i]);
+	*rMean /= Times.size();
+	for(i=0; i < (int)Times.size(); i++)
+		*rVar += (log(Times[i]) - *rMean) * (log(Times[i]) - *rMean);
+	if(Times.size() > 1)
+		*rVar /= Times.size() - 1;
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+Benchmark::Benchmark()
+{
+	MySeeds.push_back(1);
+	MySeeds.push_back(2);
+	MySeeds.push_back(3);
+	iMyReps = 3;
+	iMyDeadline = 60;
+	iMyNbrOfThreads = 1;
+}
+
+
+Benchmark::~Benchmark()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+/*
+***Description***
+The method reads the instances from a suite file. Each line contains the name of an input file
+followed by the width to be tested or by "opt" for optimize mode; empty lines and lines
+starting with '#' are ignored.
+
+INPUT:	cNameOfFile: Name of the suite file
+*/
+
+void Benchmark::readSuite(const char *cNameOfFile)
+{
+	int iLine = 0;
+	string Line, File, Mode, Rest;
+	ifstream In;
+	istringstream LineIn;
+	BenchInstance Instance;
+
+	In.open(cNameOfFile, ios::in);
+	if(!In.is_open())
+		writeErrorMsg("Error opening suite file.", "Benchmark::readSuite");
+
+	while(getline(In, Line)) {
+		++iLine;
+		LineIn.clear();
+		LineIn.str(Line);
+		if(!(LineIn >> File) || (File[0] == '#'))
+			continue;
+		if(!(LineIn >> Mode) || (LineIn >> Rest)) {
+			cerr << cNameOfFile << ":" << iLine << ": expected '<file> <k>' or '<file> opt'." << endl;
+			exit(EXIT_FAILURE);
+		}
+
+		Instance.File = File;
+		Instance.iK = (Mode == "opt") ? 0 : atoi(Mode.c_str());
+		if((Mode != "opt") && (Instance.iK <= 0)) {
+			cerr << cNameOfFile << ":" << iLine << ": illegal width " << Mode << "." << endl;
+			exit(EXIT_FAILURE);
+		}
+		MyInstances.push_back(Instance);
+	}
+}
+
+
+void Benchmark::addInstance(const string &File, int iK)
+{
+	BenchInstance Instance;
+
+	Instance.File = File;
+	Instance.iK = iK;
+	MyInstances.push_back(Instance);
+}
+
+
+void Benchmark::setWidth(int iK)
+{
+	for(int i=0; i < (int)MyInstances.size(); i++)
+		MyInstances[i].iK = iK;
+}
+
+
+void Benchmark::setSeeds(const vector<unsigned int> &Seeds)
+{
+	MySeeds = Seeds;
+}
+
+
+void Benchmark::setReps(int iReps)
+{
+	iMyReps = iReps;
+}
+
+
+void Benchmark::setDeadline(int iSeconds)
+{
+	iMyDeadline = iSeconds;
+}
+
+
+void Benchmark::setThreads(int iNbrOfThreads)
+{
+	iMyNbrOfThreads = iNbrOfThreads;
+}
+
+
+int Benchmark::getNbrOfInstances()
+{
+	return (int)MyInstances.size();
+}
+
+
+/*
+***Description***
+The method decomposes an instance in a child process such that the peak memory of the run can
+be measured and a crash does not end the benchmark. The child loads the instance by the library,
+searches, and sends the status, the times, and the counters through a pipe; the parent measures
+the wall time of the whole process.
+
+INPUT:	Instance: Instance to be decomposed
+		iSeed: Seed of the random order of the hyperedges
+		iRep: Number of the repetition
+OUTPUT: Run: Result of the run
+*/
+
+void Benchmark::runOnce(BenchInstance *Instance, unsigned int iSeed, int iRep, BenchRun *Run)
+{
+	int iPipe[2], iStatus, iWidth, iLength;
+	long long lLoadTime, lDecompTime, lCalls, lSeps, lCutParts;
+	char cLine[1024];
+	string Output;
+	pid_t Pid;
+	struct rusage Usage;
+	chrono::steady_clock::time_point Start;
+
+	Run->Instance = Instance->File;
+	Run->Mode = (Instance->iK > 0) ? "k=" + to_string(Instance->iK) : "opt";
+	Run->iSeed = iSeed;
+	Run->iRep = iRep;
+	Run->Status = "error";
+	Run->iWidth = 0;
+	Run->lLoadTime = Run->lDecompTime = Run->lWallTime = 0;
+	Run->lNbrOfCalls = Run->lNbrOfSeps = Run->lNbrOfCutParts = Run->lPeakRSS = 0;
+
+	if(pipe(iPipe) != 0)
+		writeErrorMsg("Error creating pipe.", "Benchmark::runOnce");
+	cout.flush();
+	Start = chrono::steady_clock::now();
+	Pid = fork();
+	if(Pid < 0)
+		writeErrorMsg("Error creating process.", "Benchmark::runOnce");
+
+	if(Pid == 0) {
+		Decomposer D;
+
+		close(iPipe[0]);
+		try {
+			D.setSeed(iSeed);
+			D.setDeadline(iMyDeadline);
+			D.setThreads(iMyNbrOfThreads);
+			D.loadFile(Instance->File.c_str(), false);
+			iStatus = (Instance->iK > 0) ? D.decompose(Instance->iK) : D.optimize();
+			snprintf(cLine, sizeof(cLine), "%d %d %lld %lld %lld %lld %lld\n", iStatus, D.getResult()->iWidth, D.getLoadTime(),
+				D.getDecompTime(), D.getNbrOfCalls(), D.getNbrOfSeps(), D.getNbrOfCutParts());
+		}
+		catch(exception &E) {
+			snprintf(cLine, sizeof(cLine), "%d %s\n", DK_ERROR, E.what());
+		}
+		iLength = (int)write(iPipe[1], cLine, strlen(cLine));
+		_exit(iLength == (int)strlen(cLine) ? EXIT_SUCCESS : EXIT_FAILURE);
+	}
+
+	// Collect the output of the child until it closes the pipe
+	close(iPipe[1]);
+	while((iLength = (int)read(iPipe[0], cLine, sizeof(cLine))) > 0)
+		Output.append(cLine, iLength);
+	close(iPipe[0]);
+	if(wait4(Pid, &iStatus, 0, &Usage) < 0)
+		writeErrorMsg("Error waiting for process.", "Benchmark::runOnce");
+	Run->lWallTime = chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now() - Start).count();
+	Run->lPeakRSS = Usage.ru_maxrss;
+
+	if(!WIFEXITED(iStatus) || (WEXITSTATUS(iStatus) != EXIT_SUCCESS)) {
+		cerr << Instance->File << ": process terminated abnormally." << endl;
+		return;
+	}
+	if(sscanf(Output.c_str(), "%d %d %lld %lld %lld %lld %lld", &iStatus, &iWidth, &lLoadTime, &lDecompTime, &lCalls, &lSeps, &lCutParts) != 7) {
+		cerr << Instance->File << ": " << Output.substr(Output.find(' ')+1);
+		return;
+	}
+
+	Run->Status = (iStatus == DK_FOUND) ? "found" : (iStatus == DK_STOPPED) ? "stopped" : "not_found";
+	Run->iWidth = iWidth;
+	Run->lLoadTime = lLoadTime;
+	Run->lDecompTime = lDecompTime;
+	Run->lNbrOfCalls = lCalls;
+	Run->lNbrOfSeps = lSeps;
+	Run->lNbrOfCutParts = lCutParts;
+}
+
+
+/*
+***Description***
+The method runs all instances of the suite for all seeds; each seed is repeated iMyReps times
+to measure the variation of the times of the same search.
+
+INPUT:	bVerbose: true if a line is written to the standard output per run
+*/
+
+void Benchmark::run(bool bVerbose)
+{
+	int i, j, r;
+	BenchRun Run;
+
+	for(i=0; i < (int)MyInstances.size(); i++)
+		for(j=0; j < (int)MySeeds.size(); j++)
+			for(r=1; r <= iMyReps; r++) {
+				runOnce(&MyInstances[i], MySeeds[j], r, &Run);
+				MyRuns.push_back(Run);
+				if(bVerbose) {
+					cout << Run.Instance << " " << Run.Mode << " seed " << Run.iSeed << " rep " << Run.iRep << ": " << Run.Status;
+					if(Run.iWidth > 0)
+						cout << " (width " << Run.iWidth << ")";
+					cout << ", " << fixed << setprecision(6) << Run.lDecompTime / 1e9 << " sec, ";
+					cout << Run.lNbrOfCalls << " decomp calls, " << Run.lPeakRSS << " KB" << endl;
+					cout.unsetf(ios::floatfield);
+				}
+			}
+}
+
+
+/*
+***Description***
+The method writes the results of all runs into a JSON file (an array with one object per run)
+if the file name ends with ".json" and into a CSV file otherwise. Only CSV files can be read
+back as baseline.
+
+INPUT:	cNameOfFile: Name of the results file
+*/
+
+void Benchmark::writeResults(const char *cNameOfFile)
+{
+	int i;
+	bool bJSON = (strlen(cNameOfFile) >= 5) && (strcmp(cNameOfFile + strlen(cNameOfFile) - 5, ".json") == 0);
+	BenchRun *Run;
+	FileWriter Out;
+
+	if(!Out.open(cNameOfFile))
+		writeErrorMsg("Error opening results file.", "Benchmark::writeResults");
+
+	Out << (bJSON ? "[" : BENCH_CSV_HEADER "\n");
+	for(i=0; i < (int)MyRuns.size(); i++) {
+		Run = &MyRuns[i];
+		if(bJSON) {
+			Out << ((i > 0) ? ",\n" : "\n") << "{\"instance\": " << toJSON(Run->Instance).c_str() << ", \"mode\": \"" << Run->Mode.c_str();
+			Out << "\", \"seed\": " << (long long)Run->iSeed << ", \"rep\": " << Run->iRep << ", \"status\": \"" << Run->Status.c_str();
+			Out << "\", \"width\": " << Run->iWidth << ", \"load_ns\": " << Run->lLoadTime << ", \"decomp_ns\": " << Run->lDecompTime;
+			Out << ", \"wall_ns\": " << Run->lWallTime << ", \"decomp_calls\": " << Run->lNbrOfCalls << ", \"separators\": " << Run->lNbrOfSeps;
+			Out << ", \"pruned_components\": " << Run->lNbrOfCutParts << ", \"peak_rss_kb\": " << Run->lPeakRSS << "}";
+		}
+		else {
+			Out << Run->Instance.c_str() << ',' << Run->Mode.c_str() << ',' << (long long)Run->iSeed << ',' << Run->iRep << ',';
+			Out << Run->Status.c_str() << ',' << Run->iWidth << ',' << Run->lLoadTime << ',' << Run->lDecompTime << ',' << Run->lWallTime << ',';
+			Out << Run->lNbrOfCalls << ',' << Run->lNbrOfSeps << ',' << Run->lNbrOfCutParts << ',' << Run->lPeakRSS << '\n';
+		}
+	}
+	if(bJSON)
+		Out << "\n]\n";
+
+	if(!Out.close())
+		writeErrorMsg("Error writing results file.", "Benchmark::writeResults");
+}
+
+
+void Benchmark::readResults(const char *cNameOfFile, vector<BenchRun> *Runs)
+{
+	string Line, Field;
+	vector<string> Fields;
+	ifstream In;
+	istringstream LineIn;
+	BenchRun Run;
+
+	In.open(cNameOfFile, ios::in);
+	if(!In.is_open())
+		writeErrorMsg("Error opening baseline file.", "Benchmark::readResults");
+	if(!getline(In, Line) || (Line != BENCH_CSV_HEADER))
+		writeErrorMsg("Invalid baseline file (expected CSV results).", "Benchmark::readResults");
+
+	while(getline(In, Line)) {
+		if(Line.empty())
+			continue;
+		Fields.clear();
+		LineIn.clear();
+		LineIn.str(Line);
+		while(getline(LineIn, Field, ','))
+			Fields.push_back(Field);
+		if(Fields.size() != 13)
+			writeErrorMsg("Invalid baseline file (expected CSV results).", "Benchmark::readResults");
+
+		Run.Instance = Fields[0];
+		Run.Mode = Fields[1];
+		Run.iSeed = (unsigned int)strtoul(Fields[2].c_str(), NULL, 10);
+		Run.iRep = atoi(Fields[3].c_str());
+		Run.Status = Fields[4];
+		Run.iWidth = atoi(Fields[5].c_str());
+		Run.lLoadTime = atoll(Fields[6].c_str());
+		Run.lDecompTime = atoll(Fields[7].c_str());
+		Run.lWallTime = atoll(Fields[8].c_str());
+		Run.lNbrOfCalls = atoll(Fields[9].c_str());
+		Run.lNbrOfSeps = atoll(Fields[10].c_str());
+		Run.lNbrOfCutParts = atoll(Fields[11].c_str());
+		Run.lPeakRSS = atoll(Fields[12].c_str());
+		Runs->push_back(Run);
+	}
+}
+
+
+/*
+***Description***
+The method compares the search times of each instance and mode with those of the baseline.
+Since search times are roughly log-normally distributed, the logarithms of the times of all
+seeds and repetitions are compared by Welch's t-test. An instance is reported as slower if the
+ratio of the geometric means exceeds 1+rThreshold and the one-sided p-value is below rAlpha
+(and as faster in the symmetric case). Differences in the decomp calls for the same seed are
+reported as well, since they indicate that the search itself and not only its speed changed.
+
+INPUT:	Baseline: Results of the baseline
+		rThreshold: Minimum relative slowdown (e.g., 0.05)
+		rAlpha: Significance level (e.g., 0.05)
+		Out: Output stream for the comparison table
+OUTPUT: return: Number of instances that are significantly slower
+*/
+
+int Benchmark::compare(vector<BenchRun> *Baseline, double rThreshold, double rAlpha, ostream &Out)
+{
+	int iNbrOfSlower = 0, i, j, l;
+	double rMeanB, rVarB, rMeanC, rVarC, rSE, t, rDF, rRatio, rPSlower, rPFaster;
+	bool bStopped, bSearchDiffers;
+	string Verdict;
+	vector<double> TimesB, TimesC;
+	vector<pair<string, string> > Keys;
+
+	// Instances and modes in the order of the current runs
+	for(i=0; i < (int)MyRuns.size(); i++)
+		if(Keys.empty() || (Keys.back() != make_pair(MyRuns[i].Instance, MyRuns[i].Mode)))
+			Keys.push_back(make_pair(MyRuns[i].Instance, MyRuns[i].Mode));
+
+	Out << left << setw(50) << "instance" << setw(6) << "mode" << right << setw(12) << "base(s)" << setw(12) << "current(s)";
+	Out << setw(8) << "ratio" << setw(10) << "p-value" << "  verdict" << endl;
+	for(i=0; i < (int)Keys.size(); i++) {
+		TimesB.clear();
+		TimesC.clear();
+		bStopped = bSearchDiffers = false;
+		for(j=0; j < (int)MyRuns.size(); j++)
+			if((MyRuns[j].Instance == Keys[i].first) && (MyRuns[j].Mode == Keys[i].second)) {
+				if((MyRuns[j].Status == "stopped") || (MyRuns[j].Status == "error"))
+					bStopped = true;
+				TimesC.push_back(max(MyRuns[j].lDecompTime, 1LL));
+			}
+		for(j=0; j < (int)Baseline->size(); j++)
+			if(((*Baseline)[j].Instance == Keys[i].first) && ((*Baseline)[j].Mode == Keys[i].second)) {
+				if(((*Baseline)[j].Status == "stopped") || ((*Baseline)[j].Status == "error"))
+					bStopped = true;
+				TimesB.push_back(max((*Baseline)[j].lDecompTime, 1LL));
+			}
+
+		// The same seed must lead to the same search
+		for(j=0; j < (int)MyRuns.size(); j++)
+			if((MyRuns[j].Instance == Keys[i].first) && (MyRuns[j].Mode == Keys[i].second))
+				for(l=0; l < (int)Baseline->size(); l++)
+					if(((*Baseline)[l].Instance == Keys[i].first) && ((*Baseline)[l].Mode == Keys[i].second) && ((*Baseline)[l].iSeed == MyRuns[j].iSeed) && ((*Baseline)[l].lNbrOfCalls != MyRuns[j].lNbrOfCalls))
+						bSearchDiffers = true;
+
+		Out << left << setw(50) << Keys[i].first << setw(6) << Keys[i].second << right;
+		if(TimesB.empty()) {
+			Out << setw(12) << "-" << setw(12) << "-" << setw(8) << "-" << setw(10) << "-" << "  not in baseline" << endl;
+			continue;
+		}
+
+		logMoments(TimesB, &rMeanB, &rVarB);
+		logMoments(TimesC, &rMeanC, &rVarC);
+		rRatio = exp(rMeanC - rMeanB);
+
+		// Welch's t-test on the logarithms of the times
+		rSE = sqrt(rVarB / TimesB.size() + rVarC / TimesC.size());
+		if((TimesB.size() < 2) || (TimesC.size() < 2))
+			rPSlower = rPFaster = 1;
+		else if(rSE == 0)
+			rPSlower = rPFaster = (rMeanC == rMeanB) ? 1 : 0;
+		else {
+			t = (rMeanC - rMeanB) / rSE;
+			rDF = pow(rSE, 4) / (pow(rVarB / TimesB.size(), 2) / (TimesB.size()-1) + pow(rVarC / TimesC.size(), 2) / (TimesC.size()-1));
+			rPSlower = studentTail(t, rDF);
+			rPFaster = studentTail(-t, rDF);
+		}
+
+		if(bStopped)
+			Verdict = "stopped (times not comparable)";
+		else if((rRatio > 1 + rThreshold) && (rPSlower < rAlpha)) {
+			Verdict = "SLOWER";
+			++iNbrOfSlower;
+		}
+		else if((rRatio < 1 - rThreshold) && (rPFaster < rAlpha))
+			Verdict = "faster";
+		else
+			Verdict = "unchanged";
+		if(bSearchDiffers)
+			Verdict += " (search differs)";
+
+		Out << fixed << setprecision(6) << setw(12) << exp(rMeanB) / 1e9 << setw(12) << exp(rMeanC) / 1e9;
+		Out << setprecision(3) << setw(8) << rRatio << setprecision(4) << setw(10) << ((rRatio >= 1) ? rPSlower : rPFaster);
+		Out << "  " << Verdict << endl;
+		Out.unsetf(ios::floatfield);
+	}
+
+	return iNbrOfSlower;
+}
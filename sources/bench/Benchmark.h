@@ -0,0 +1,102 @@
+// Models a benchmark of det-k-decomp: a suite of instances is decomposed for several seeds and
+// repetitions, each run in a separate process, and the times, search counters, and peak memory
+// are recorded and compared with a baseline.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_BENCHMARK)
+#define CLS_BENCHMARK
+
+#include <vector>
+#include <string>
+#include <ostream>
+
+using namespace std;
+
+
+// Instance of the suite together with the width to be tested (0 for optimize mode)
+struct BenchInstance
+{
+	string File;
+	int iK;
+};
+
+// Result of a single run
+struct BenchRun
+{
+	// Instance and mode ("k=<k>" or "opt"), seed, and repetition
+	string Instance, Mode;
+	unsigned int iSeed;
+	int iRep;
+
+	// Status ("found", "not_found", "stopped", or "error") and width (0 if none)
+	string Status;
+	int iWidth;
+
+	// Times in nanoseconds for loading, searching, and the whole process
+	long long lLoadTime, lDecompTime, lWallTime;
+
+	// Search counters
+	long long lNbrOfCalls, lNbrOfSeps, lNbrOfCutParts;
+
+	// Peak resident set size of the process in kilobytes
+	long long lPeakRSS;
+};
+
+class Benchmark
+{
+private:
+	// Instances of the suite
+	vector<BenchInstance> MyInstances;
+
+	// Seeds, number of repetitions per seed, deadline in seconds, and threads used by optimize
+	vector<unsigned int> MySeeds;
+	int iMyReps, iMyDeadline, iMyNbrOfThreads;
+
+	// Results of the runs
+	vector<BenchRun> MyRuns;
+
+	// Decomposes an instance in a child process
+	void runOnce(BenchInstance *Instance, unsigned int iSeed, int iRep, BenchRun *Run);
+
+public:
+	// Constructor
+	Benchmark();
+
+	// Destructor
+	virtual ~Benchmark();
+
+	// Reads the instances from a suite file
+	void readSuite(const char *cNameOfFile);
+
+	// Adds an instance to the suite
+	void addInstance(const string &File, int iK);
+
+	// Sets the width of all instances (0 for optimize mode)
+	void setWidth(int iK);
+
+	// Sets the seeds, the number of repetitions, the deadline, and the threads used by optimize
+	void setSeeds(const vector<unsigned int> &Seeds);
+	void setReps(int iReps);
+	void setDeadline(int iSeconds);
+	void setThreads(int iNbrOfThreads);
+
+	// Returns the number of instances in the suite
+	int getNbrOfInstances();
+
+	// Runs all instances for all seeds and repetitions
+	void run(bool bVerbose);
+
+	// Writes the results as CSV or JSON file (according to the extension)
+	void writeResults(const char *cNameOfFile);
+
+	// Reads results written as CSV file
+	static void readResults(const char *cNameOfFile, vector<BenchRun> *Runs);
+
+	// Compares the search times with a baseline; returns the number of significant slowdowns
+	int compare(vector<BenchRun> *Baseline, double rThreshold, double rAlpha, ostream &Out);
+};
+
+
+#endif // !defined(CLS_BENCHMARK)
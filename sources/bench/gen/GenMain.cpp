@@ -0,0 +1,131 @@
+// Generator of synthetic hypergraphs for scaling studies of det-k-decomp: writes a member of a
+// parametrized family in the text format or the binary format.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+
+using namespace std;
+
+#include "Generator.h"
+#include "../../Globals.h"
+
+
+void usage(char *cProgram)
+{
+	cerr << "Usage: " << cProgram << " grid --dim <d> --size <n> [options] <output file>" << endl;
+	cerr << "       " << cProgram << " uniform --nodes <n> --edges <m> --arity <r> [options] <output file>" << endl;
+	cerr << "       " << cProgram << " csp --vars <n> --arity <r> --density <constraints per variable> [options] <output file>" << endl;
+	cerr << "       " << cProgram << " adder --size <bits> [options] <output file>" << endl;
+	cerr << "       " << cProgram << " bridge --size <bridges> [options] <output file>" << endl;
+	cerr << "       " << cProgram << " planted --bags <b> --width <w> [--arity <r>] [--overlap <s>] [--extra <e>] [options] <output file>" << endl;
+	cerr << "Options: --seed <n>  seed of the random number generator (default 1)" << endl;
+	cerr << "         --binary    write the binary format instead of the text format" << endl;
+	exit(EXIT_FAILURE);
+}
+
+
+// Converts a non-negative integer argument; exits if the argument is illegal
+int parseNumber(const char *cOption, char *cArg)
+{
+	char *cEnd;
+	long iValue = strtol(cArg, &cEnd, 10);
+
+	if((*cEnd != '\0') || (iValue < 0) || (iValue > 2147483647L)) {
+		cerr << "Illegal argument " << cOption << " " << cArg << "." << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	return (int)iValue;
+}
+
+
+int main(int argc, char **argv)
+{
+	int iDim = 0, iSize = 0, iNbrOfNodes = 0, iNbrOfEdges = 0, iArity = 0, iNbrOfBags = 0, iWidth = 0;
+	int iOverlap = 2, iExtra = 0, i;
+	unsigned int iSeed = 1;
+	double rDensity = 0;
+	bool bBinary = false;
+	char *cFamily, *cEnd;
+	string Comment;
+	Generator Gen;
+
+	if(argc < 3)
+		usage(argv[0]);
+	cFamily = argv[1];
+
+	Comment = "Generated by dkgen " + string(cFamily);
+	for(i=2; (i < argc-1) && (argv[i][0] == '-'); i++) {
+		if(strcmp(argv[i], "--binary") == 0) {
+			bBinary = true;
+			continue;
+		}
+		if(i+1 >= argc-1)
+			usage(argv[0]);
+		Comment += " " + string(argv[i]) + " " + string(argv[i+1]);
+
+		if(strcmp(argv[i], "--dim") == 0)
+			iDim = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--size") == 0)
+			iSize = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--nodes") == 0)
+			iNbrOfNodes = parseNumber(argv[i], argv[i+1]);
+		else if((strcmp(argv[i], "--edges") == 0))
+			iNbrOfEdges = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--vars") == 0)
+			iNbrOfNodes = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--arity") == 0)
+			iArity = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--density") == 0) {
+			rDensity = strtod(argv[i+1], &cEnd);
+			if((*cEnd != '\0') || (rDensity <= 0)) {
+				cerr << "Illegal argument " << argv[i] << " " << argv[i+1] << "." << endl;
+				exit(EXIT_FAILURE);
+			}
+		}
+		else if(strcmp(argv[i], "--bags") == 0)
+			iNbrOfBags = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--width") == 0)
+			iWidth = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--overlap") == 0)
+			iOverlap = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--extra") == 0)
+			iExtra = parseNumber(argv[i], argv[i+1]);
+		else if(strcmp(argv[i], "--seed") == 0)
+			iSeed = (unsigned int)parseNumber(argv[i], argv[i+1]);
+		else
+			usage(argv[0]);
+		++i;
+	}
+	if(i != argc-1)
+		usage(argv[0]);
+
+	random_init(iSeed);
+	if(strcmp(cFamily, "grid") == 0)
+		Gen.makeGrid(iDim, iSize);
+	else if(strcmp(cFamily, "uniform") == 0)
+		Gen.makeUniform(iNbrOfNodes, iNbrOfEdges, iArity);
+	else if(strcmp(cFamily, "csp") == 0)
+		Gen.makeCSP(iNbrOfNodes, iArity, rDensity);
+	else if(strcmp(cFamily, "adder") == 0)
+		Gen.makeAdder(iSize);
+	else if(strcmp(cFamily, "bridge") == 0)
+		Gen.makeBridge(iSize);
+	else if(strcmp(cFamily, "planted") == 0)
+		Gen.makePlanted(iNbrOfBags, iWidth, (iArity > 0) ? iArity : 3, iOverlap, iExtra);
+	else
+		usage(argv[0]);
+
+	if(bBinary)
+		Gen.writeBinary(argv[argc-1]);
+	else
+		Gen.writeText(argv[argc-1], Comment.c_str());
+	cout << Gen.getNbrOfEdges() << " hyperedges and " << Gen.getNbrOfNodes() << " nodes written to: " << argv[argc-1] << endl;
+
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,449 @@
+// Generator.cpp: implementation of the Generator class.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#include <cstdio>
+#include <algorithm>
+#include <set>
+
+using namespace std;
+
+#include "Generator.h"
+#include "../../Hypergraph.h"
+#include "../../BinaryFormat.h"
+#include "../../FileWriter.h"
+#include "../../Globals.h"
+
+
+// Maximum number of points of a grid
+#define GEN_MAX_GRID_POINTS 100000000
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+Generator::Generator()
+{
+	MyEdgeNodeStart.push_back(0);
+}
+
+
+Generator::~Generator()
+{
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+void Generator::clear()
+{
+	MyEdgeNames.clear();
+	MyNodeNames.clear();
+	MyEdgeNodeStart.assign(1, 0);
+	MyEdgeNodes.clear();
+	MyNodeIDs.clear();
+}
+
+
+int Generator::getNode(const string &Name)
+{
+	map<string, int>::iterator NodeIter;
+
+	NodeIter = MyNodeIDs.find(Name);
+	if(NodeIter != MyNodeIDs.end())
+		return NodeIter->second;
+
+	MyNodeNames.push_back(Name);
+	MyNodeIDs[Name] = (int)MyNodeNames.size()-1;
+
+	return (int)MyNodeNames.size()-1;
+}
+
+
+/*
+***Description***
+The method adds a hyperedge consisting of the given nodes; multiple occurrences of a node are
+removed, and the nodes are stored in ascending order as required by the binary format.
+
+INPUT:	Name: Name of the hyperedge
+		Nodes: Numbers of the nodes
+OUTPUT: -
+*/
+
+void Generator::addEdge(const string &Name, vector<int> *Nodes)
+{
+	sort(Nodes->begin(), Nodes->end());
+	Nodes->erase(unique(Nodes->begin(), Nodes->end()), Nodes->end());
+
+	MyEdgeNames.push_back(Name);
+	MyEdgeNodes.insert(MyEdgeNodes.end(), Nodes->begin(), Nodes->end());
+	MyEdgeNodeStart.push_back((int)MyEdgeNodes.size());
+}
+
+
+void Generator::addEdge(const string &Name, const string &Node1, const string &Node2, const string &Node3, const string &Node4)
+{
+	vector<int> Nodes;
+
+	Nodes.push_back(getNode(Node1));
+	Nodes.push_back(getNode(Node2));
+	if(!Node3.empty())
+		Nodes.push_back(getNode(Node3));
+	if(!Node4.empty())
+		Nodes.push_back(getNode(Node4));
+	addEdge(Name, &Nodes);
+}
+
+
+void Generator::selectRandom(int iRange, int iSize, vector<int> *Selection)
+{
+	int iValue;
+
+	if(iSize > iRange)
+		writeErrorMsg("Selection larger than range.", "Generator::selectRandom");
+
+	Selection->clear();
+	while((int)Selection->size() < iSize) {
+		iValue = random_range(0, iRange-1);
+		if(find(Selection->begin(), Selection->end(), iValue) == Selection->end())
+			Selection->push_back(iValue);
+	}
+}
+
+
+/*
+***Description***
+The method generates the dual of a d-dimensional grid in the style of the Grid2D benchmarks:
+each point of the grid with an odd sum of coordinates is a hyperedge (named C<c1>:...:<cd>)
+consisting of its neighbouring points (named X<c1>:...:<cd>), which all have an even sum of
+coordinates.
+
+INPUT:	iDim: Number of dimensions
+		iSize: Number of points per dimension
+OUTPUT: -
+*/
+
+void Generator::makeGrid(int iDim, int iSize)
+{
+	int iSum, i, j;
+	long long lNbrOfPoints = 1;
+	vector<int> Point, Nodes;
+	string Coords;
+	char cNumber[16];
+
+	if((iDim < 1) || (iSize < 2))
+		writeErrorMsg("Illegal grid dimensions.", "Generator::makeGrid");
+	for(i=0; i < iDim; i++)
+		if((lNbrOfPoints *= iSize) > GEN_MAX_GRID_POINTS)
+			writeErrorMsg("Grid too large.", "Generator::makeGrid");
+
+	clear();
+	Point.assign(iDim, 0);
+	do {
+		for(iSum=i=0; i < iDim; i++)
+			iSum += Point[i];
+
+		if(iSum % 2 == 1) {
+			// Collect the neighbours of the point
+			Nodes.clear();
+			for(i=0; i < iDim; i++)
+				for(j=-1; j <= 1; j+=2)
+					if((Point[i]+j >= 0) && (Point[i]+j < iSize)) {
+						Point[i] += j;
+						Coords.clear();
+						for(iSum=0; iSum < iDim; iSum++) {
+							sprintf(cNumber, (iSum > 0) ? ":%d" : "%d", Point[iSum]);
+							Coords += cNumber;
+						}
+						Nodes.push_back(getNode("X" + Coords));
+						Point[i] -= j;
+					}
+
+			Coords.clear();
+			for(i=0; i < iDim; i++) {
+				sprintf(cNumber, (i > 0) ? ":%d" : "%d", Point[i]);
+				Coords += cNumber;
+			}
+			addEdge("C" + Coords, &Nodes);
+		}
+
+		// Continue with the next point
+		for(i=iDim-1; (i >= 0) && (++Point[i] == iSize); i--)
+			Point[i] = 0;
+	} while(i >= 0);
+}
+
+
+/*
+***Description***
+The method generates a random hypergraph in which each hyperedge consists of iArity distinct
+nodes chosen uniformly at random. Only nodes contained in some hyperedge are created.
+
+INPUT:	iNbrOfNodes: Number of nodes to choose from
+		iNbrOfEdges: Number of hyperedges
+		iArity: Number of nodes per hyperedge
+OUTPUT: -
+*/
+
+void Generator::makeUniform(int iNbrOfNodes, int iNbrOfEdges, int iArity)
+{
+	int i, j;
+	vector<int> Selection, Nodes;
+
+	if((iArity < 1) || (iArity > iNbrOfNodes) || (iNbrOfEdges < 1))
+		writeErrorMsg("Illegal parameters of a uniform hypergraph.", "Generator::makeUniform");
+
+	clear();
+	for(i=0; i < iNbrOfEdges; i++) {
+		selectRandom(iNbrOfNodes, iArity, &Selection);
+		Nodes.clear();
+		for(j=0; j < iArity; j++)
+			Nodes.push_back(getNode("V" + to_string(Selection[j])));
+		addEdge("E" + to_string(i), &Nodes);
+	}
+}
+
+
+/*
+***Description***
+The method generates a random CSP instance in the style of model B: round(rDensity*iNbrOfVars)
+constraints of arity iArity are chosen uniformly at random among all scopes without repetition.
+Only variables occurring in some constraint are created.
+
+INPUT:	iNbrOfVars: Number of variables
+		iArity: Number of variables per constraint
+		rDensity: Number of constraints per variable
+OUTPUT: -
+*/
+
+void Generator::makeCSP(int iNbrOfVars, int iArity, double rDensity)
+{
+	int iNbrOfCons, i;
+	double rNbrOfScopes = 1;
+	vector<int> Scope, Nodes;
+	set<vector<int> > Scopes;
+
+	if((iArity < 1) || (iArity > iNbrOfVars) || (rDensity <= 0))
+		writeErrorMsg("Illegal parameters of a CSP.", "Generator::makeCSP");
+
+	// Check whether there are enough distinct scopes
+	iNbrOfCons = (int)(rDensity * iNbrOfVars + 0.5);
+	for(i=0; i < iArity; i++)
+		rNbrOfScopes = rNbrOfScopes * (iNbrOfVars-i) / (i+1);
+	if((iNbrOfCons < 1) || (iNbrOfCons > rNbrOfScopes))
+		writeErrorMsg("Illegal number of constraints.", "Generator::makeCSP");
+
+	clear();
+	while((int)Scopes.size() < iNbrOfCons) {
+		selectRandom(iNbrOfVars, iArity, &Scope);
+		sort(Scope.begin(), Scope.end());
+		if(!Scopes.insert(Scope).second)
+			continue;
+
+		Nodes.clear();
+		for(i=0; i < iArity; i++)
+			Nodes.push_back(getNode("X" + to_string(Scope[i])));
+		addEdge("C" + to_string(Scopes.size()-1), &Nodes);
+	}
+}
+
+
+/*
+***Description***
+The method generates an iSize-bit ripple-carry adder with the gates and names of the adder
+benchmarks of DaimlerChrysler: each bit consists of two half adders and an or-gate.
+
+INPUT:	iSize: Number of bits
+OUTPUT: -
+*/
+
+void Generator::makeAdder(int iSize)
+{
+	int i;
+	string Bit, Prev;
+	vector<int> Nodes;
+
+	if(iSize < 1)
+		writeErrorMsg("Illegal size of an adder.", "Generator::makeAdder");
+
+	clear();
+	for(i=1; i <= iSize; i++) {
+		Bit = to_string(i);
+		Prev = to_string(i-1);
+		addEdge("xor" + Bit, "TempG" + Bit, "I" + to_string(2*i-1), "I" + to_string(2*i));
+		addEdge("and" + Bit, "TempHa" + Bit, "I" + to_string(2*i-1), "I" + to_string(2*i));
+		addEdge("xorA" + Bit, "C" + Prev, "S" + Bit, "TempG" + Bit);
+		addEdge("andA" + Bit, "C" + Prev, "TempG" + Bit, "TempHb" + Bit);
+		addEdge("or" + Bit, "TempHa" + Bit, "TempHb" + Bit, "C" + Bit);
+	}
+
+	// The carry into the first bit
+	Nodes.push_back(getNode("C0"));
+	addEdge("init", &Nodes);
+}
+
+
+/*
+***Description***
+The method generates a chain of iSize bridge circuits with the gates and names of the bridge
+benchmarks of DaimlerChrysler.
+
+INPUT:	iSize: Number of bridges
+OUTPUT: -
+*/
+
+void Generator::makeBridge(int iSize)
+{
+	int i;
+	string V, Next;
+	vector<int> Nodes;
+
+	if(iSize < 1)
+		writeErrorMsg("Illegal size of a bridge chain.", "Generator::makeBridge");
+
+	clear();
+	for(i=1; i <= iSize; i++) {
+		V = "v" + to_string(i);
+		Next = "v" + to_string(i+1);
+		addEdge("N1" + V, "Iq" + V, "IR2" + V, "IR1" + V);
+		addEdge("N2" + V, "IR1" + V, "IR4" + V, "IR3" + V);
+		addEdge("N3" + V, "IR5" + V, "IR2" + V, "IR3" + V);
+		addEdge("N4" + V, "IR5" + V, "IR4" + V, "Im" + V);
+		addEdge("M1" + V, "IR3" + V, "IR2" + V, "IR1" + V);
+		addEdge("M2" + V, "IR4" + V, "IR5" + V, "IR3" + V);
+		addEdge("M3" + V, "IR4" + V, "Um" + V, "Uq" + V, "IR1" + V);
+		addEdge("ICONN" + V, "Im" + V, "Iq" + Next);
+		addEdge("UCONN" + V, "Um" + V, "Uq" + Next);
+	}
+
+	// The ends of the chain
+	Nodes.push_back(getNode("Uqv1"));
+	addEdge("Init", &Nodes);
+	Nodes.assign(1, getNode("Uq" + Next));
+	addEdge("Term", &Nodes);
+}
+
+
+/*
+***Description***
+The method generates a hypergraph with a planted hypertree decomposition. The bags form a random
+recursive tree; each bag consists of iWidth hyperedges of iArity nodes whose union is its
+chi-set. The first hyperedge of a bag shares iOverlap nodes with the chi-set of the parent bag,
+each further hyperedge shares one node with the previous hyperedges of the bag, and all other
+nodes are new. Additionally, iExtra hyperedges per bag are random subsets of its chi-set. Since
+every hyperedge is covered by a bag and the chi-set of each bag is the union of its lambda-set,
+the bags form a hypertree decomposition of width at most iWidth.
+
+INPUT:	iNbrOfBags: Number of bags
+		iWidth: Number of hyperedges per bag
+		iArity: Number of nodes per hyperedge
+		iOverlap: Number of nodes shared with the parent bag
+		iExtra: Number of additional hyperedges per bag
+OUTPUT: -
+*/
+
+void Generator::makePlanted(int iNbrOfBags, int iWidth, int iArity, int iOverlap, int iExtra)
+{
+	int iNbrOfNodes = 0, iParent, i, j, k;
+	vector<vector<int> > Chi;
+	vector<int> Selection, Nodes;
+
+	if((iNbrOfBags < 1) || (iWidth < 1) || (iArity < 2) || (iOverlap < 1) || (iOverlap > iArity) || (iExtra < 0))
+		writeErrorMsg("Illegal parameters of a planted decomposition.", "Generator::makePlanted");
+
+	clear();
+	Chi.resize(iNbrOfBags);
+	for(i=0; i < iNbrOfBags; i++) {
+		iParent = (i > 0) ? random_range(0, i-1) : -1;
+
+		for(j=0; j < iWidth; j++) {
+			Nodes.clear();
+			if((j == 0) && (iParent >= 0)) {
+				// Share nodes with the parent bag
+				selectRandom((int)Chi[iParent].size(), min(iOverlap, (int)Chi[iParent].size()), &Selection);
+				for(k=0; k < (int)Selection.size(); k++)
+					Nodes.push_back(Chi[iParent][Selection[k]]);
+			}
+			else if(j > 0)
+				// Share a node with the previous hyperedges of the bag
+				Nodes.push_back(Chi[i][random_range(0, (int)Chi[i].size()-1)]);
+
+			// Complete the hyperedge by new nodes
+			while((int)Nodes.size() < iArity) {
+				k = getNode("X" + to_string(iNbrOfNodes++));
+				Nodes.push_back(k);
+				Chi[i].push_back(k);
+			}
+			if((j == 0) && (iParent >= 0))
+				Chi[i].insert(Chi[i].end(), Nodes.begin(), Nodes.begin()+Selection.size());
+			addEdge("E" + to_string(MyEdgeNames.size()), &Nodes);
+		}
+
+		for(j=0; j < iExtra; j++) {
+			selectRandom((int)Chi[i].size(), min(iArity, (int)Chi[i].size()), &Selection);
+			Nodes.clear();
+			for(k=0; k < (int)Selection.size(); k++)
+				Nodes.push_back(Chi[i][Selection[k]]);
+			addEdge("E" + to_string(MyEdgeNames.size()), &Nodes);
+		}
+	}
+}
+
+
+int Generator::getNbrOfEdges()
+{
+	return (int)MyEdgeNames.size();
+}
+
+
+int Generator::getNbrOfNodes()
+{
+	return (int)MyNodeNames.size();
+}
+
+
+void Generator::writeText(const char *cNameOfFile, const char *cComment)
+{
+	int i, j;
+	FileWriter Out;
+
+	if(!Out.open(cNameOfFile))
+		writeErrorMsg("Error opening file.", "Generator::writeText");
+
+	Out << "% " << cComment << ": " << getNbrOfEdges() << " atoms, " << getNbrOfNodes() << " variables\n\n";
+	for(i=0; i < getNbrOfEdges(); i++) {
+		Out << MyEdgeNames[i].c_str() << " (";
+		for(j=MyEdgeNodeStart[i]; j < MyEdgeNodeStart[i+1]; j++)
+			Out << ((j > MyEdgeNodeStart[i]) ? ", " : "") << MyNodeNames[MyEdgeNodes[j]].c_str();
+		Out << ((i < getNbrOfEdges()-1) ? "),\n" : ").\n");
+	}
+
+	if(!Out.close())
+		writeErrorMsg("Error writing file.", "Generator::writeText");
+}
+
+
+void Generator::writeBinary(const char *cNameOfFile)
+{
+	int i;
+	vector<char *> EdgeNames, NodeNames;
+	Hypergraph HG;
+	BinaryFormat BF;
+
+	// The hypergraph refers to the names of the generator
+	for(i=0; i < getNbrOfEdges(); i++)
+		EdgeNames.push_back((char *)MyEdgeNames[i].c_str());
+	for(i=0; i < getNbrOfNodes(); i++)
+		NodeNames.push_back((char *)MyNodeNames[i].c_str());
+
+	HG.buildHypergraph(getNbrOfEdges(), getNbrOfNodes(), MyEdgeNodeStart.data(), MyEdgeNodes.data(), EdgeNames.data(), NodeNames.data());
+	BF.writeHypergraph(&HG, cNameOfFile);
+}
@@ -0,0 +1,85 @@
+// Models a generator of synthetic hypergraphs in parametrized families (grids, random uniform
+// hypergraphs, random CSPs, adder and bridge circuits, and hypergraphs of planted width) that
+// are written in the text format or the binary format of det-k-decomp.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_GENERATOR)
+#define CLS_GENERATOR
+
+#include <vector>
+#include <string>
+#include <map>
+
+using namespace std;
+
+
+class Generator
+{
+private:
+	// Names of the hyperedges and nodes
+	vector<string> MyEdgeNames, MyNodeNames;
+
+	// Nodes of the hyperedges; the nodes of edge e are MyEdgeNodes[MyEdgeNodeStart[e]], ...,
+	// MyEdgeNodes[MyEdgeNodeStart[e+1]-1] in ascending order
+	vector<int> MyEdgeNodeStart, MyEdgeNodes;
+
+	// Numbers of the nodes by their names
+	map<string, int> MyNodeIDs;
+
+	// Returns the number of a node and creates the node if it does not exist yet
+	int getNode(const string &Name);
+
+	// Adds a hyperedge consisting of the given nodes
+	void addEdge(const string &Name, vector<int> *Nodes);
+
+	// Adds a hyperedge consisting of the nodes with the given names
+	void addEdge(const string &Name, const string &Node1, const string &Node2, const string &Node3 = "", const string &Node4 = "");
+
+	// Selects iSize distinct random numbers in [0, iRange)
+	void selectRandom(int iRange, int iSize, vector<int> *Selection);
+
+public:
+	// Constructor
+	Generator();
+
+	// Destructor
+	virtual ~Generator();
+
+	// Removes all hyperedges and nodes
+	void clear();
+
+	// Generates the dual of a d-dimensional grid with iSize points per dimension
+	void makeGrid(int iDim, int iSize);
+
+	// Generates a random hypergraph with iNbrOfEdges hyperedges of iArity nodes each
+	void makeUniform(int iNbrOfNodes, int iNbrOfEdges, int iArity);
+
+	// Generates a random CSP with rDensity constraints per variable and distinct scopes
+	void makeCSP(int iNbrOfVars, int iArity, double rDensity);
+
+	// Generates an iSize-bit ripple-carry adder
+	void makeAdder(int iSize);
+
+	// Generates a chain of iSize bridge circuits
+	void makeBridge(int iSize);
+
+	// Generates a hypergraph with a planted hypertree decomposition of width at most iWidth
+	void makePlanted(int iNbrOfBags, int iWidth, int iArity, int iOverlap, int iExtra);
+
+	// Returns the number of hyperedges
+	int getNbrOfEdges();
+
+	// Returns the number of nodes
+	int getNbrOfNodes();
+
+	// Writes the hypergraph in the text format with a comment in the first line
+	void writeText(const char *cNameOfFile, const char *cComment);
+
+	// Writes the hypergraph in the binary format
+	void writeBinary(const char *cNameOfFile);
+};
+
+
+#endif // !defined(CLS_GENERATOR)
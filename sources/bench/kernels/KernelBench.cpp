@@ -0,0 +1,780 @@
+// KernelBench.cpp: implementation of the KernelBench class.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#include <cstring>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+
+#include <list>
+#include <set>
+#include <vector>
+
+using namespace std;
+
+#include "KernelBench.h"
+#include "../../Hypergraph.h"
+#include "../../Hyperedge.h"
+#include "../../Hypertree.h"
+#include "../../Node.h"
+#include "../../CompSet.h"
+#include "../../SetCover.h"
+#include "../../FileWriter.h"
+#include "../../Globals.h"
+
+
+// Minimum and maximum number of rounds per kernel
+#define KB_MIN_ROUNDS 3
+#define KB_MAX_ROUNDS 1000
+
+// Maximum number of captured components and separators
+#define KB_MAX_CAPTURE 100000
+
+// Maximum number of covering selections enumerated per component
+#define KB_MAX_COVERS 1000
+
+
+/*
+***Description***
+The function returns the value of the steady clock in nanoseconds.
+
+INPUT:	-
+OUTPUT: return: Nanoseconds since the epoch of the steady clock
+*/
+
+static inline long long nowNS()
+{
+	return (long long)chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+
+/*
+***Description***
+The function collects all nodes of a hypertree in preorder.
+
+INPUT:	HTree: Hypertree
+OUTPUT: Nodes: Hypertree nodes
+*/
+
+static void collectHTNodes(Hypertree *HTree, vector<Hypertree *> *Nodes)
+{
+	list<Hypertree *>::iterator ChildIter;
+
+	Nodes->push_back(HTree);
+	for(ChildIter=HTree->getChildren()->begin(); ChildIter != HTree->getChildren()->end(); ChildIter++)
+		collectHTNodes(*ChildIter, Nodes);
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Construction/Destruction
+//////////////////////////////////////////////////////////////////////
+
+
+KernelBench::KernelBench()
+{
+	MyHGraph = NULL;
+	iMyK = 0;
+	MyOrder = NULL;
+	MyHTree = NULL;
+	iMySamples = 200;
+	lMyMinTime = 100000000;
+	lMyMaxCalls = 100000;
+	MyDecomp.setVerbose(false);
+}
+
+
+KernelBench::~KernelBench()
+{
+	clear();
+}
+
+
+
+//////////////////////////////////////////////////////////////////////
+// Class methods
+//////////////////////////////////////////////////////////////////////
+
+
+void KernelBench::setSamples(int iSamples)
+{
+	iMySamples = iSamples;
+}
+
+
+void KernelBench::setMinTime(int iMilliseconds)
+{
+	lMyMinTime = (long long)iMilliseconds * 1000000;
+}
+
+
+void KernelBench::setMaxCalls(long long lMaxCalls)
+{
+	lMyMaxCalls = lMaxCalls;
+}
+
+
+int KernelBench::getNbrOfComps()
+{
+	return (int)MyComps.size();
+}
+
+
+int KernelBench::getNbrOfSeps()
+{
+	return (int)MySeps.size();
+}
+
+
+bool KernelBench::hasHTree()
+{
+	return MyHTree != NULL;
+}
+
+
+/*
+***Description***
+The method runs det-k-decomp on a hypergraph step by step as buildHypertree does and captures
+the component and connector of each decomp call that is not decomposed trivially as well as each
+separator examined. The search is abandoned after lMyMaxCalls decomp calls. If a decomposition
+is found, its pruned nodes are expanded and it is shrunk as for the output. The memo tables of
+the search are kept for timing getSepParts.
+
+INPUT:	HGraph: Hypergraph
+		iK: Maximum separator size
+		iSeed: Seed of the random number generator
+OUTPUT: -
+*/
+
+void KernelBench::capture(Hypergraph *HGraph, int iK, unsigned int iSeed)
+{
+	int iDepth, i;
+	bool bEnter, bFinished;
+	Node *Connector[1];
+	DecompFrame *F;
+	KernelComp Comp;
+	KernelSep Sep;
+	vector<int> CompOfDepth;
+	list<Hypertree *> CutNodes;
+
+	clear();
+	MyHGraph = HGraph;
+	iMyK = iK;
+	random_init(iSeed);
+
+	// Order hyperedges heuristically
+	HGraph->makeDual();
+	MyOrder = (Hyperedge **)HGraph->getMCSOrder();
+	HGraph->makeDual();
+	for(i=0; i < HGraph->getNbrOfEdges(); i++)
+		MyOrder[i]->setWeight(i);
+
+	MyDecomp.MyHGraph = HGraph;
+	MyDecomp.iMyK = iK;
+	MyDecomp.lMyNbrOfCalls = MyDecomp.lMyNbrOfSeps = MyDecomp.lMyNbrOfCutParts = 0;
+	Connector[0] = NULL;
+	MyDecomp.pushFrame(MyOrder, Connector, 0);
+	do {
+		F = MyDecomp.MyStack.back();
+		iDepth = (int)MyDecomp.MyStack.size()-1;
+
+		// Capture the separator examined in this step
+		if((F->iState == DS_SEPARATE) && ((int)MySeps.size() < KB_MAX_CAPTURE)) {
+			Sep.iComp = CompOfDepth[iDepth];
+			Sep.iSepSize = F->iSepSize;
+			Sep.Separator = new Hyperedge*[F->iSepSize+1];
+			if(Sep.Separator == NULL)
+				writeErrorMsg("Error assigning memory.", "KernelBench::capture");
+			for(i=0; i < F->iNbrSelCov; i++)
+				Sep.Separator[i] = F->BoundEdges[F->CovSepSet[i]];
+			if(F->bAddEdge)
+				Sep.Separator[i++] = F->AddEdges[F->iAddEdge];
+			Sep.Separator[i] = NULL;
+			MySeps.push_back(Sep);
+		}
+
+		bEnter = F->iState == DS_ENTER;
+		bFinished = MyDecomp.step(0);
+
+		// Capture the component of a decomp call that was not decomposed trivially
+		if(bEnter && !bFinished && (MyDecomp.MyStack.back() == F)) {
+			if((int)CompOfDepth.size() <= iDepth)
+				CompOfDepth.resize(iDepth+1);
+			CompOfDepth[iDepth] = -1;
+			if((int)MyComps.size() < KB_MAX_CAPTURE) {
+				Comp.iNbrOfEdges = F->iNbrOfEdges;
+				for(Comp.iNbrOfConnNodes=0; F->Connector[Comp.iNbrOfConnNodes] != NULL; Comp.iNbrOfConnNodes++);
+				Comp.HEdges = new Hyperedge*[Comp.iNbrOfEdges+1];
+				Comp.Connector = new Node*[Comp.iNbrOfConnNodes+1];
+				if((Comp.HEdges == NULL) || (Comp.Connector == NULL))
+					writeErrorMsg("Error assigning memory.", "KernelBench::capture");
+				memcpy(Comp.HEdges, F->HEdges, (Comp.iNbrOfEdges+1)*sizeof(Hyperedge *));
+				memcpy(Comp.Connector, F->Connector, (Comp.iNbrOfConnNodes+1)*sizeof(Node *));
+				CompOfDepth[iDepth] = (int)MyComps.size();
+				MyComps.push_back(Comp);
+			}
+		}
+	} while(!bFinished && (MyDecomp.lMyNbrOfCalls <= lMyMaxCalls));
+
+	// Separators of components that were not captured cannot be timed
+	for(i=0; i < (int)MySeps.size(); i++)
+		if(MySeps[i].iComp < 0) {
+			delete [] MySeps[i].Separator;
+			MySeps.erase(MySeps.begin()+i--);
+		}
+
+	if(!bFinished) {
+		MyDecomp.clearStack();
+		return;
+	}
+
+	// Expand pruned hypertree nodes and shrink the decomposition
+	MyHTree = MyDecomp.MyResult;
+	if(MyHTree != NULL) {
+		MyHTree->getCutNodes(&CutNodes);
+		if(!CutNodes.empty())
+			MyDecomp.expandHTree(&CutNodes);
+		MyHTree->swapChiLambda();
+		MyHTree->shrink(true);
+		MyHTree->swapChiLambda();
+	}
+}
+
+
+void KernelBench::clear()
+{
+	int i;
+
+	for(i=0; i < (int)MyComps.size(); i++) {
+		delete [] MyComps[i].HEdges;
+		delete [] MyComps[i].Connector;
+	}
+	MyComps.clear();
+
+	for(i=0; i < (int)MySeps.size(); i++)
+		delete [] MySeps[i].Separator;
+	MySeps.clear();
+
+	MyDecomp.clearSeps();
+	delete [] MyOrder;
+	MyOrder = NULL;
+	delete MyHTree;
+	MyHTree = NULL;
+	MyResults.clear();
+}
+
+
+void KernelBench::selectSamples(int iSize, vector<int> *Samples)
+{
+	int iNbrOfSamples = min(iSize, iMySamples), i;
+
+	Samples->clear();
+	for(i=0; i < iNbrOfSamples; i++)
+		Samples->push_back((int)((long long)i * iSize / iNbrOfSamples));
+}
+
+
+void KernelBench::labelSep(KernelSep *Sep)
+{
+	int i, j;
+
+	MyHGraph->resetEdgeLabels();
+	MyHGraph->resetNodeLabels();
+	for(i=0; Sep->Separator[i] != NULL; i++) {
+		Sep->Separator[i]->setLabel(-1);
+		for(j=0; j < Sep->Separator[i]->getNbrOfNodes(); j++)
+			Sep->Separator[i]->getNode(j)->setLabel(-1);
+	}
+}
+
+
+/*
+***Description***
+The method stores the time of the last round and checks whether another round has to be timed,
+i.e., whether fewer than KB_MIN_ROUNDS rounds were timed or the total time is below the minimum
+time per kernel (and fewer than KB_MAX_ROUNDS rounds were timed).
+
+INPUT:	Rounds: Times of the previous rounds
+		lRoundTime: Time of the last round in nanoseconds
+		lTotal: Total time of the previous rounds
+OUTPUT: Rounds: Times of all rounds
+		lTotal: Total time of all rounds
+		return: true if another round has to be timed; otherwise false
+*/
+
+bool KernelBench::nextRound(vector<long long> *Rounds, long long lRoundTime, long long *lTotal)
+{
+	Rounds->push_back(lRoundTime);
+	*lTotal += lRoundTime;
+
+	if((int)Rounds->size() < KB_MIN_ROUNDS)
+		return true;
+
+	return (*lTotal < lMyMinTime) && ((int)Rounds->size() < KB_MAX_ROUNDS) && (lRoundTime > 0);
+}
+
+
+void KernelBench::addResult(const char *cKernel, const char *cUnit, int iSamples, long long lCalls, long long lUnits, vector<long long> *Rounds)
+{
+	KernelResult Result;
+
+	if(iSamples == 0)
+		return;
+
+	sort(Rounds->begin(), Rounds->end());
+	Result.Kernel = cKernel;
+	Result.Unit = cUnit;
+	Result.lSamples = iSamples;
+	Result.lCalls = lCalls;
+	Result.lUnits = lUnits;
+	Result.iRounds = (int)Rounds->size();
+	Result.lMedianTime = (*Rounds)[Rounds->size()/2];
+	Result.lMinTime = (*Rounds)[0];
+	MyResults.push_back(Result);
+}
+
+
+/*
+***Description***
+The method times the enumeration of the selections of covering hyperedges by setInitSubset and
+setNextSubset for the connectors of the captured components, i.e., the work done by the search
+in DS_ENTER and DS_NEXT_COVER. At most KB_MAX_COVERS selections are enumerated per component.
+The unit of work is a selection.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchCoverNodes()
+{
+	int iCompEnd, iBoundSize, iNbrSel, i, j;
+	long long lStart, lTime, lTotal = 0, lUnits;
+	bool bNext;
+	KernelComp *C;
+	DecompFrame Frame;
+	Hyperedge **Inner;
+	vector<int> Samples, BoundSizes;
+	vector<Hyperedge **> Bounds;
+	vector<bool *> InComps;
+	vector<long long> Rounds;
+	int *Set, *CovWeights;
+
+	// Divide the components and initialize the auxiliary arrays as in DS_ENTER
+	selectSamples((int)MyComps.size(), &Samples);
+	for(i=0; i < (int)Samples.size(); i++) {
+		C = &MyComps[Samples[i]];
+		if(C->iNbrOfConnNodes == 0)
+			continue;
+		Bounds.push_back(NULL);
+		iCompEnd = MyDecomp.divideCompEdges(C->HEdges, C->Connector, &Inner, &Bounds.back());
+		delete [] Inner;
+		for(iBoundSize=0; Bounds.back()[iBoundSize] != NULL; iBoundSize++);
+		BoundSizes.push_back(iBoundSize);
+		InComps.push_back(new bool[iBoundSize]);
+		if(InComps.back() == NULL)
+			writeErrorMsg("Error assigning memory.", "KernelBench::benchCoverNodes");
+		for(j=0; j < iBoundSize; j++)
+			InComps.back()[j] = j < iCompEnd;
+		Samples[(int)Bounds.size()-1] = Samples[i];
+	}
+	Samples.resize(Bounds.size());
+
+	// setInitSubset and setNextSubset expect an active decomp call on the search stack
+	Frame.bTraced = false;
+	Frame.iRecLevel = 0;
+	MyDecomp.MyStack.push_back(&Frame);
+	Set = new int[iMyK+1];
+	if(Set == NULL)
+		writeErrorMsg("Error assigning memory.", "KernelBench::benchCoverNodes");
+
+	do {
+		lTime = lUnits = 0;
+		for(i=0; i < (int)Samples.size(); i++) {
+			C = &MyComps[Samples[i]];
+			CovWeights = new int[BoundSizes[i]];
+			if(CovWeights == NULL)
+				writeErrorMsg("Error assigning memory.", "KernelBench::benchCoverNodes");
+
+			lStart = nowNS();
+			iNbrSel = MyDecomp.setInitSubset(C->Connector, Bounds[i], Set, InComps[i], CovWeights, BoundSizes[i]);
+			for(j=0, bNext=iNbrSel >= 0; bNext && (j < KB_MAX_COVERS); j++)
+				bNext = MyDecomp.setNextSubset(C->Connector, Bounds[i], Set, InComps[i], CovWeights, BoundSizes[i]) > 0;
+			lTime += nowNS() - lStart;
+			lUnits += (iNbrSel >= 0) ? j : 0;
+
+			delete [] CovWeights;
+		}
+	} while(nextRound(&Rounds, lTime, &lTotal));
+
+	MyDecomp.MyStack.pop_back();
+	delete [] Set;
+	for(i=0; i < (int)Bounds.size(); i++) {
+		delete [] Bounds[i];
+		delete [] InComps[i];
+	}
+
+	addResult("coverNodes", "selection", (int)Samples.size(), (long long)Samples.size(), lUnits, &Rounds);
+}
+
+
+/*
+***Description***
+The method times divideCompEdges on the captured components and their connectors. The unit of
+work is a hyperedge of the component.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchDivideCompEdges()
+{
+	int i;
+	long long lStart, lTime, lTotal = 0, lUnits;
+	KernelComp *C;
+	Hyperedge **Inner, **Bound;
+	vector<int> Samples;
+	vector<long long> Rounds;
+
+	selectSamples((int)MyComps.size(), &Samples);
+	do {
+		lTime = lUnits = 0;
+		for(i=0; i < (int)Samples.size(); i++) {
+			C = &MyComps[Samples[i]];
+			lStart = nowNS();
+			MyDecomp.divideCompEdges(C->HEdges, C->Connector, &Inner, &Bound);
+			lTime += nowNS() - lStart;
+			lUnits += C->iNbrOfEdges;
+			delete [] Inner;
+			delete [] Bound;
+		}
+	} while(nextRound(&Rounds, lTime, &lTotal));
+
+	addResult("divideCompEdges", "hyperedge", (int)Samples.size(), (long long)Samples.size(), lUnits, &Rounds);
+}
+
+
+/*
+***Description***
+The method times collectReachEdges on the captured separators: the hyperedges of each separated
+component are labeled as in separate, and each call collecting one partition is timed on its own.
+The unit of work is a hyperedge collected.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchCollectReachEdges()
+{
+	int iLabel, i, j;
+	long long lStart, lTime, lTotal = 0, lUnits, lCalls;
+	Hyperedge **HEdges;
+	list<Hyperedge *> Edges;
+	list<Node *> Connector;
+	list<Node *>::iterator NodeIter;
+	vector<int> Samples;
+	vector<long long> Rounds;
+
+	selectSamples((int)MySeps.size(), &Samples);
+	do {
+		lTime = lUnits = lCalls = 0;
+		for(i=0; i < (int)Samples.size(); i++) {
+			labelSep(&MySeps[Samples[i]]);
+			HEdges = MyComps[MySeps[Samples[i]].iComp].HEdges;
+			for(iLabel=1, j=0; HEdges[j] != NULL; j++)
+				if(HEdges[j]->getLabel() == 0) {
+					Edges.clear();
+					Connector.clear();
+					lStart = nowNS();
+					MyDecomp.collectReachEdges(HEdges[j], iLabel++, &Edges, &Connector);
+					lTime += nowNS() - lStart;
+					lUnits += (long long)Edges.size();
+					++lCalls;
+
+					// Restore the labels of the connector nodes as separate does
+					for(NodeIter=Connector.begin(); NodeIter != Connector.end(); NodeIter++)
+						(*NodeIter)->setLabel(-1);
+				}
+		}
+	} while(nextRound(&Rounds, lTime, &lTotal));
+
+	addResult("collectReachEdges", "hyperedge", (int)Samples.size(), lCalls, lUnits, &Rounds);
+}
+
+
+/*
+***Description***
+The method times separate on the captured separators, labeled as in DS_SEPARATE. The unit of work
+is a hyperedge of the separated component.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchSeparate()
+{
+	int iNbrOfParts, i, j;
+	long long lStart, lTime, lTotal = 0, lUnits;
+	Hyperedge ***Partitions;
+	Node ***Connectors;
+	vector<int> Samples;
+	vector<long long> Rounds;
+
+	selectSamples((int)MySeps.size(), &Samples);
+	do {
+		lTime = lUnits = 0;
+		for(i=0; i < (int)Samples.size(); i++) {
+			labelSep(&MySeps[Samples[i]]);
+			lStart = nowNS();
+			iNbrOfParts = MyDecomp.separate(MyComps[MySeps[Samples[i]].iComp].HEdges, &Partitions, &Connectors);
+			lTime += nowNS() - lStart;
+			lUnits += MyComps[MySeps[Samples[i]].iComp].iNbrOfEdges;
+
+			for(j=0; j < iNbrOfParts; j++) {
+				delete [] Partitions[j];
+				delete [] Connectors[j];
+			}
+			delete [] Partitions;
+			delete [] Connectors;
+		}
+	} while(nextRound(&Rounds, lTime, &lTotal));
+
+	addResult("separate", "hyperedge", (int)Samples.size(), (long long)Samples.size(), lUnits, &Rounds);
+}
+
+
+/*
+***Description***
+The method times the lookup of the captured separators by getSepParts in the memo tables left by
+the search. The unit of work is a separator stored in the memo tables.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchGetSepParts()
+{
+	int i, j;
+	long long lStart, lTime, lTotal = 0;
+	Hyperedge **Separator;
+	list<Hyperedge *> *SuccParts, *FailParts;
+	list<Hyperedge **> *SuccSeps;
+	vector<int> Samples;
+	vector<long long> Rounds;
+
+	selectSamples((int)MySeps.size(), &Samples);
+	do {
+		lTime = 0;
+		for(i=0; i < (int)Samples.size(); i++) {
+			MyHGraph->resetEdgeLabels();
+			for(j=0; MySeps[Samples[i]].Separator[j] != NULL; j++)
+				MySeps[Samples[i]].Separator[j]->setLabel(-1);
+			lStart = nowNS();
+			MyDecomp.getSepParts(MySeps[Samples[i]].iSepSize, &Separator, &SuccParts, &SuccSeps, &FailParts);
+			lTime += nowNS() - lStart;
+		}
+	} while(nextRound(&Rounds, lTime, &lTotal));
+
+	addResult("getSepParts", "memo entry", (int)Samples.size(), (long long)Samples.size(), (long long)Samples.size() * MyDecomp.MySeps.size(), &Rounds);
+}
+
+
+/*
+***Description***
+The method times orderMCS on copies of the hyperedges of the captured components. The unit of
+work is a hyperedge of the component.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchOrderMCS()
+{
+	int i;
+	long long lStart, lTime, lTotal = 0, lUnits;
+	KernelComp *C;
+	Hyperedge **HEdges;
+	vector<int> Samples;
+	vector<long long> Rounds;
+
+	HEdges = new Hyperedge*[MyHGraph->getNbrOfEdges()+1];
+	if(HEdges == NULL)
+		writeErrorMsg("Error assigning memory.", "KernelBench::benchOrderMCS");
+
+	selectSamples((int)MyComps.size(), &Samples);
+	do {
+		lTime = lUnits = 0;
+		for(i=0; i < (int)Samples.size(); i++) {
+			C = &MyComps[Samples[i]];
+			memcpy(HEdges, C->HEdges, (C->iNbrOfEdges+1)*sizeof(Hyperedge *));
+			MyHGraph->resetEdgeLabels();
+			MyHGraph->resetNodeLabels();
+			lStart = nowNS();
+			MyDecomp.orderMCS(HEdges, C->iNbrOfEdges);
+			lTime += nowNS() - lStart;
+			lUnits += C->iNbrOfEdges;
+		}
+	} while(nextRound(&Rounds, lTime, &lTotal));
+
+	delete [] HEdges;
+
+	addResult("orderMCS", "hyperedge", (int)Samples.size(), (long long)Samples.size(), lUnits, &Rounds);
+}
+
+
+/*
+***Description***
+The method times SetCover::cover on the chi- and lambda-sets of the nodes of the decomposition
+found, as used by Hypertree::elimCovEdges. The unit of work is a node of the chi-set.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchSetCover()
+{
+	int i;
+	long long lStart, lTime, lTotal = 0, lUnits;
+	SetCover SC;
+	CompSet *Nodes, *HEdges, *CovEdges;
+	Hypertree *HTNode;
+	vector<Hypertree *> HTNodes;
+	vector<int> Samples;
+	vector<long long> Rounds;
+	set<Node *>::iterator ChiIter;
+	set<Hyperedge *>::iterator LambdaIter;
+
+	collectHTNodes(MyHTree, &HTNodes);
+	selectSamples((int)HTNodes.size(), &Samples);
+	do {
+		lTime = lUnits = 0;
+		for(i=0; i < (int)Samples.size(); i++) {
+			HTNode = HTNodes[Samples[i]];
+			Nodes = new CompSet((int)HTNode->getChi()->size());
+			HEdges = new CompSet((int)HTNode->getLambda()->size());
+			if((Nodes == NULL) || (HEdges == NULL))
+				writeErrorMsg("Error assigning memory.", "KernelBench::benchSetCover");
+			for(ChiIter=HTNode->getChi()->begin(); ChiIter != HTNode->getChi()->end(); ChiIter++)
+				Nodes->insComp(*ChiIter);
+			for(LambdaIter=HTNode->getLambda()->begin(); LambdaIter != HTNode->getLambda()->end(); LambdaIter++)
+				HEdges->insComp(*LambdaIter);
+
+			lStart = nowNS();
+			CovEdges = SC.cover(Nodes, HEdges);
+			lTime += nowNS() - lStart;
+			lUnits += Nodes->size();
+
+			delete Nodes;
+			delete HEdges;
+			delete CovEdges;
+		}
+	} while(nextRound(&Rounds, lTime, &lTotal));
+
+	addResult("SetCover::cover", "chi node", (int)Samples.size(), (long long)Samples.size(), lUnits, &Rounds);
+}
+
+
+/*
+***Description***
+The method times the verification of each hypertree condition on the decomposition found, as
+done by verify in Main.cpp. The unit of work is a hypertree node.
+
+INPUT:	-
+OUTPUT: -
+*/
+
+void KernelBench::benchCheckConds()
+{
+	int iCond;
+	long long lStart, lTime, lTotal;
+	vector<Hypertree *> HTNodes;
+	vector<long long> Rounds;
+	const char *cKernels[4] = { "Hypertree::checkCond1", "Hypertree::checkCond2", "Hypertree::checkCond3", "Hypertree::checkCond4" };
+
+	collectHTNodes(MyHTree, &HTNodes);
+	for(iCond=0; iCond < 4; iCond++) {
+		Rounds.clear();
+		lTotal = 0;
+		do {
+			MyHTree->resetLabels();
+			MyHTree->setIDLabels();
+			lStart = nowNS();
+			switch(iCond) {
+				case 0: MyHTree->checkCond1(MyHGraph); break;
+				case 1: MyHTree->checkCond2(MyHGraph); break;
+				case 2: MyHTree->checkCond3(MyHGraph); break;
+				case 3: MyHTree->checkCond4(MyHGraph); break;
+			}
+			lTime = nowNS() - lStart;
+		} while(nextRound(&Rounds, lTime, &lTotal));
+
+		addResult(cKernels[iCond], "tree node", 1, 1, (long long)HTNodes.size(), &Rounds);
+	}
+}
+
+
+/*
+***Description***
+The method times each kernel whose name starts with cFilter on the captured subproblems. Kernels
+working on the decomposition are skipped if no decomposition was found.
+
+INPUT:	cFilter: Prefix of the kernel names; NULL for all kernels
+OUTPUT: -
+*/
+
+void KernelBench::run(const char *cFilter)
+{
+	int i;
+	const char *cKernels[8] = { "coverNodes", "divideCompEdges", "collectReachEdges", "separate", "getSepParts", "orderMCS", "SetCover::cover", "Hypertree::checkCond" };
+
+	MyResults.clear();
+	for(i=0; i < 8; i++) {
+		if((cFilter != NULL) && (strncmp(cKernels[i], cFilter, strlen(cFilter)) != 0))
+			continue;
+		if((i >= 6) && (MyHTree == NULL))
+			continue;
+		switch(i) {
+			case 0: benchCoverNodes(); break;
+			case 1: benchDivideCompEdges(); break;
+			case 2: benchCollectReachEdges(); break;
+			case 3: benchSeparate(); break;
+			case 4: benchGetSepParts(); break;
+			case 5: benchOrderMCS(); break;
+			case 6: benchSetCover(); break;
+			case 7: benchCheckConds(); break;
+		}
+	}
+}
+
+
+void KernelBench::writeTable(ostream &Out)
+{
+	int i;
+	KernelResult *R;
+
+	Out << left << setw(24) << "kernel" << setw(12) << "unit" << right << setw(9) << "samples" << setw(10) << "calls";
+	Out << setw(12) << "units" << setw(8) << "rounds" << setw(14) << "ns/call" << setw(12) << "ns/unit" << setw(12) << "min ns/unit" << endl;
+	for(i=0; i < (int)MyResults.size(); i++) {
+		R = &MyResults[i];
+		Out << left << setw(24) << R->Kernel << setw(12) << R->Unit << right << setw(9) << R->lSamples << setw(10) << R->lCalls;
+		Out << setw(12) << R->lUnits << setw(8) << R->iRounds << fixed << setprecision(1);
+		Out << setw(14) << (double)R->lMedianTime / max(R->lCalls, 1LL);
+		Out << setw(12) << (double)R->lMedianTime / max(R->lUnits, 1LL) << setw(12) << (double)R->lMinTime / max(R->lUnits, 1LL) << endl;
+	}
+	Out.unsetf(ios::floatfield);
+}
+
+
+void KernelBench::writeCSV(FileWriter &Out, const char *cInstance)
+{
+	int i;
+	KernelResult *R;
+
+	for(i=0; i < (int)MyResults.size(); i++) {
+		R = &MyResults[i];
+		Out << cInstance << ',' << iMyK << ',' << R->Kernel.c_str() << ',' << R->Unit.c_str() << ',' << R->lSamples << ',';
+		Out << R->lCalls << ',' << R->lUnits << ',' << R->iRounds << ',' << R->lMedianTime << ',' << R->lMinTime << '\n';
+	}
+}
@@ -0,0 +1,150 @@
+// Models microbenchmarks of the search kernels of det-k-decomp: the components and separators
+// examined by a search on a real instance are captured, and each kernel is then timed on these
+// subproblems in isolation, independent of the order in which the search visits them.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#if !defined(CLS_KERNELBENCH)
+#define CLS_KERNELBENCH
+
+#include <vector>
+#include <string>
+#include <ostream>
+
+using namespace std;
+
+#include "../../DetKDecomp.h"
+
+class Hypergraph;
+class Hyperedge;
+class Hypertree;
+class Node;
+class FileWriter;
+
+
+// Component of a decomp call captured during the search
+struct KernelComp
+{
+	// Hyperedges and connector nodes (both terminated by NULL)
+	Hyperedge **HEdges;
+	Node **Connector;
+
+	// Number of hyperedges and connector nodes
+	int iNbrOfEdges, iNbrOfConnNodes;
+};
+
+// Separator examined during the search
+struct KernelSep
+{
+	// Position of the separated component in the captured components
+	int iComp;
+
+	// Separating hyperedges (terminated by NULL) and their number
+	Hyperedge **Separator;
+	int iSepSize;
+};
+
+// Timing of a kernel on the captured subproblems
+struct KernelResult
+{
+	// Name of the kernel and of the unit of work
+	string Kernel, Unit;
+
+	// Number of subproblems, of kernel calls, and of units per round, and number of rounds
+	long long lSamples, lCalls, lUnits;
+	int iRounds;
+
+	// Median and minimum time in nanoseconds of a round
+	long long lMedianTime, lMinTime;
+};
+
+class KernelBench
+{
+private:
+	// Underlying hypergraph, maximum separator size, and search on which the kernels are called
+	Hypergraph *MyHGraph;
+	int iMyK;
+	DetKDecomp MyDecomp;
+
+	// Hyperedges in the order of the search
+	Hyperedge **MyOrder;
+
+	// Components and separators captured during the search
+	vector<KernelComp> MyComps;
+	vector<KernelSep> MySeps;
+
+	// Decomposition found by the search (NULL if the search was stopped or failed)
+	Hypertree *MyHTree;
+
+	// Maximum number of subproblems per kernel, minimum time per kernel in nanoseconds, and
+	// maximum number of decomp calls of the search
+	int iMySamples;
+	long long lMyMinTime, lMyMaxCalls;
+
+	// Results of the kernels
+	vector<KernelResult> MyResults;
+
+	// Selects up to iMySamples positions evenly distributed over iSize elements
+	void selectSamples(int iSize, vector<int> *Samples);
+
+	// Labels the separating nodes and hyperedges as expected by separate
+	void labelSep(KernelSep *Sep);
+
+	// Checks whether another round has to be timed and stores the time of the last round
+	bool nextRound(vector<long long> *Rounds, long long lRoundTime, long long *lTotal);
+
+	// Summarizes the rounds of a kernel
+	void addResult(const char *cKernel, const char *cUnit, int iSamples, long long lCalls, long long lUnits, vector<long long> *Rounds);
+
+	// Times the kernels on the captured subproblems
+	void benchCoverNodes();
+	void benchDivideCompEdges();
+	void benchCollectReachEdges();
+	void benchSeparate();
+	void benchGetSepParts();
+	void benchOrderMCS();
+	void benchSetCover();
+	void benchCheckConds();
+
+public:
+	// Constructor
+	KernelBench();
+
+	// Destructor
+	virtual ~KernelBench();
+
+	// Sets the maximum number of subproblems per kernel
+	void setSamples(int iSamples);
+
+	// Sets the minimum time per kernel in milliseconds
+	void setMinTime(int iMilliseconds);
+
+	// Sets the maximum number of decomp calls of the search
+	void setMaxCalls(long long lMaxCalls);
+
+	// Searches for a decomposition of width at most iK and captures its subproblems
+	void capture(Hypergraph *HGraph, int iK, unsigned int iSeed);
+
+	// Returns the numbers of captured components and separators
+	int getNbrOfComps();
+	int getNbrOfSeps();
+
+	// Checks whether the search found a decomposition
+	bool hasHTree();
+
+	// Times the kernels whose names start with cFilter (all kernels if NULL)
+	void run(const char *cFilter);
+
+	// Deletes the captured subproblems, the memo tables, and the results
+	void clear();
+
+	// Writes the results as table
+	void writeTable(ostream &Out);
+
+	// Writes the results as CSV lines prefixed with the instance and the width
+	void writeCSV(FileWriter &Out, const char *cInstance);
+};
+
+
+#endif // !defined(CLS_KERNELBENCH)
@@ -0,0 +1,187 @@
+// Microbenchmarks of det-k-decomp: captures the subproblems of a search on each instance of a
+// suite and times the search kernels and the hypertree verifiers on them in isolation.
+//
+//////////////////////////////////////////////////////////////////////
+
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#include "KernelBench.h"
+#include "../../Hypergraph.h"
+#include "../../Parser.h"
+#include "../../BinaryFormat.h"
+#include "../../PACEFormat.h"
+#include "../../Globals.h"
+#include "../../FileWriter.h"
+
+// Header of the CSV file of the results
+#define KERNELS_CSV_HEADER "instance,k,kernel,unit,samples,calls,units,rounds,median_ns,min_ns"
+
+
+void usage(char *cProgram)
+{
+	cerr << "Usage: " << cProgram << " [--suite <file>] [--k <k>] [--seed <n>] [--samples <n>] [--min-time <ms>] [--max-calls <n>]" << endl;
+	cerr << "       " << string(strlen(cProgram), ' ') << " [--kernel <name>] [--out <file>] [<instance> ...]" << endl;
+	exit(EXIT_FAILURE);
+}
+
+
+// Converts a positive integer argument; exits if the argument is illegal
+long long parsePositive(const char *cOption, char *cArg)
+{
+	char *cEnd;
+	long long lValue = strtoll(cArg, &cEnd, 10);
+
+	if((*cEnd != '\0') || (lValue < 1)) {
+		cerr << "Illegal argument " << cOption << " " << cArg << "." << endl;
+		exit(EXIT_FAILURE);
+	}
+
+	return lValue;
+}
+
+
+// Reads the instances with a fixed width from a suite file; instances in optimize mode are skipped
+void readSuite(const char *cNameOfFile, vector<pair<string, int> > *Instances)
+{
+	int iK;
+	string Line, File, Mode;
+	ifstream Suite(cNameOfFile);
+
+	if(!Suite)
+		writeErrorMsg("Suite file could not be opened.", "readSuite");
+
+	while(getline(Suite, Line)) {
+		istringstream Fields(Line);
+		if(!(Fields >> File) || (File[0] == '#'))
+			continue;
+		if(!(Fields >> Mode))
+			writeErrorMsg("Invalid suite file.", "readSuite");
+		if(Mode == "opt")
+			continue;
+		if((iK = atoi(Mode.c_str())) <= 0)
+			writeErrorMsg("Invalid suite file.", "readSuite");
+		Instances->push_back(make_pair(File, iK));
+	}
+}
+
+
+// Loads a hypergraph in any of the input formats
+void loadHypergraph(Hypergraph *HG, const char *cFile)
+{
+	Parser *P;
+	BinaryFormat BF;
+	PACEFormat PF;
+
+	if(BinaryFormat::isBinaryFile(cFile))
+		BF.readHypergraph(HG, cFile);
+	else if(PACEFormat::isPACEFile(cFile))
+		PF.readHypergraph(HG, cFile);
+	else {
+		if((P = new Parser(false)) == NULL)
+			writeErrorMsg("Error assigning memory.", "loadHypergraph");
+		P->parseFile(cFile);
+		HG->buildHypergraph(P);
+		delete P;
+	}
+}
+
+
+int main(int argc, char **argv)
+{
+	int iK = 0, i;
+	unsigned int iSeed = 1;
+	char *cSuiteFile = NULL, *cOutFile = NULL, *cKernel = NULL;
+	vector<pair<string, int> > Instances;
+	Hypergraph *HG;
+	KernelBench Bench;
+	FileWriter Out;
+
+	for(i=1; (i < argc) && (argv[i][0] == '-'); i++)
+		if((strcmp(argv[i], "--suite") == 0) && (i+1 < argc))
+			cSuiteFile = argv[++i];
+		else if((strcmp(argv[i], "--k") == 0) && (i+1 < argc)) {
+			iK = (int)parsePositive("--k", argv[i+1]);
+			++i;
+		}
+		else if((strcmp(argv[i], "--seed") == 0) && (i+1 < argc)) {
+			iSeed = (unsigned int)parsePositive("--seed", argv[i+1]);
+			++i;
+		}
+		else if((strcmp(argv[i], "--samples") == 0) && (i+1 < argc)) {
+			Bench.setSamples((int)parsePositive("--samples", argv[i+1]));
+			++i;
+		}
+		else if((strcmp(argv[i], "--min-time") == 0) && (i+1 < argc)) {
+			Bench.setMinTime((int)parsePositive("--min-time", argv[i+1]));
+			++i;
+		}
+		else if((strcmp(argv[i], "--max-calls") == 0) && (i+1 < argc)) {
+			Bench.setMaxCalls(parsePositive("--max-calls", argv[i+1]));
+			++i;
+		}
+		else if((strcmp(argv[i], "--kernel") == 0) && (i+1 < argc))
+			cKernel = argv[++i];
+		else if((strcmp(argv[i], "--out") == 0) && (i+1 < argc))
+			cOutFile = argv[++i];
+		else
+			usage(argv[0]);
+
+	// Instances are given by the suite file and the remaining arguments
+	if(cSuiteFile != NULL)
+		readSuite(cSuiteFile, &Instances);
+	for(; i < argc; i++) {
+		if(iK == 0) {
+			cerr << "Instances on the command line require --k." << endl;
+			exit(EXIT_FAILURE);
+		}
+		Instances.push_back(make_pair(string(argv[i]), iK));
+	}
+	if(Instances.empty())
+		usage(argv[0]);
+	if(iK > 0)
+		for(i=0; i < (int)Instances.size(); i++)
+			Instances[i].second = iK;
+
+	if(cOutFile != NULL) {
+		if(!Out.open(cOutFile))
+			writeErrorMsg("Output file could not be opened.", "main");
+		Out << KERNELS_CSV_HEADER "\n";
+	}
+
+	for(i=0; i < (int)Instances.size(); i++) {
+		HG = new Hypergraph;
+		if(HG == NULL)
+			writeErrorMsg("Error assigning memory.", "main");
+		loadHypergraph(HG, Instances[i].first.c_str());
+
+		Bench.capture(HG, Instances[i].second, iSeed);
+		cout << Instances[i].first << " (k=" << Instances[i].second << ", " << HG->getNbrOfEdges() << " hyperedges): ";
+		cout << Bench.getNbrOfComps() << " components and " << Bench.getNbrOfSeps() << " separators captured";
+		cout << (Bench.hasHTree() ? "" : ", no decomposition") << endl;
+
+		Bench.run(cKernel);
+		Bench.writeTable(cout);
+		cout << endl;
+		if(cOutFile != NULL)
+			Bench.writeCSV(Out, Instances[i].first.c_str());
+
+		Bench.clear();
+		delete HG;
+	}
+
+	if(cOutFile != NULL) {
+		Out.close();
+		cout << "Results written to: " << cOutFile << endl;
+	}
+
+	return EXIT_SUCCESS;
+}